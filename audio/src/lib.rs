@@ -328,6 +328,27 @@ impl AudioEngine {
         self.mix();
     }
 
+    /// Number of live one-shot sources, for the engine's memory accounting.
+    pub fn source_count(&mut self) -> usize {
+        let mut count = 0;
+        self.sources.for_each_occupied_mut(|_| count += 1);
+        count
+    }
+
+    /// Number of live streaming sources.
+    pub fn stream_count(&mut self) -> usize {
+        let mut count = 0;
+        self.streams.for_each_occupied_mut(|_| count += 1);
+        count
+    }
+
+    /// Number of live buses (including the built-in master/music/effects).
+    pub fn bus_count(&mut self) -> usize {
+        let mut count = 0;
+        self.buses.for_each_occupied_mut(|_| count += 1);
+        count
+    }
+
     fn mix(&mut self) {
         let listener_pos = self.listener_transform.transform_point3(Vec3::ZERO);
         let listener_vel = self.listener_velocity;
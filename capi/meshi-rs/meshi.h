@@ -14,8 +14,15 @@ typedef const struct MeshiPluginApi* (*MeshiPluginGetApiFn)(void);
 typedef void* (*MeshiSymbolLoader)(const char* name);
 
 #define MESHI_PLUGIN_GET_API_SYMBOL "meshi_plugin_get_api"
+#ifdef MESHI_PLUGIN_STATIC
+// Statically linked plugin: the API table comes straight from the linked-in
+// meshi_plugin_get_api symbol — no dlopen, no dlsym — and with (cross-language)
+// LTO the optimizer can see through the table and inline meshi_* calls.
+#define MESHI_PLUGIN_LOAD_API(loader_fn) (meshi_plugin_get_api())
+#else
 #define MESHI_PLUGIN_LOAD_API(loader_fn) \
     ((loader_fn) ? ((MeshiPluginGetApiFn)(loader_fn(MESHI_PLUGIN_GET_API_SYMBOL)))() : NULL)
+#endif
 
 typedef struct MeshiPluginApi {
     uint32_t abi_version;
@@ -98,6 +105,67 @@ typedef struct MeshiPluginApi {
         struct MeshiEngine* engine,
         const MeshiRenderObjectHandle* render_handle,
         const MeshiRigidBodyHandle* physics_handle);
+    void (*gfx_set_transforms)(
+        struct MeshiEngine* render,
+        const MeshiRenderObjectHandle* handles,
+        const MeshiMat4* transforms,
+        size_t count);
+    size_t (*physx_get_rigid_body_statuses)(
+        struct MeshiEngine* engine,
+        const MeshiRigidBodyHandle* handles,
+        MeshiActorStatus* out_statuses,
+        size_t count);
+    uint64_t (*physx_map_contacts)(
+        struct MeshiEngine* engine,
+        const MeshiContactInfo** out_contacts,
+        size_t* out_count);
+    size_t (*gfx_create_render_objects)(
+        struct MeshiEngine* render,
+        const MeshiRenderObjectInfo* infos,
+        MeshiRenderObjectHandle* out_handles,
+        size_t count);
+    MeshiMeshAssetHandle (*gfx_resolve_mesh)(struct MeshiEngine* engine, const char* name);
+    MeshiRenderObjectHandle (*gfx_create_render_object_from_mesh)(
+        struct MeshiEngine* render,
+        MeshiMeshAssetHandle mesh,
+        const MeshiMat4* transform);
+    int32_t (*get_frame_timings)(struct MeshiEngine* engine, MeshiFrameTimings* out_timings);
+    void (*physx_set_fixed_timestep)(struct MeshiEngine* engine, float step_secs);
+    float (*physx_get_interpolation_alpha)(struct MeshiEngine* engine);
+    int32_t (*physx_get_rigid_body_status_interpolated)(
+        struct MeshiEngine* engine,
+        const MeshiRigidBodyHandle* h,
+        float alpha,
+        MeshiActorStatus* out_status);
+    size_t (*physx_get_rigid_body_statuses_interpolated)(
+        struct MeshiEngine* engine,
+        const MeshiRigidBodyHandle* handles,
+        float alpha,
+        MeshiActorStatus* out_statuses,
+        size_t count);
+    MeshiAsyncRenderLoadHandle (*gfx_create_render_object_async)(
+        struct MeshiEngine* render,
+        const MeshiRenderObjectInfo* info);
+    int32_t (*gfx_poll_async_render_object)(
+        struct MeshiEngine* render,
+        MeshiAsyncRenderLoadHandle ticket,
+        MeshiRenderObjectHandle* out_handle);
+    void (*gfx_set_async_load_budget)(struct MeshiEngine* engine, float milliseconds);
+    MeshiInstanceGroupHandle (*gfx_create_instanced_render_object)(
+        struct MeshiEngine* render,
+        const MeshiRenderObjectInfo* info,
+        const MeshiMat4* instances,
+        size_t count);
+    size_t (*gfx_update_instance_transforms)(
+        struct MeshiEngine* render,
+        MeshiInstanceGroupHandle group,
+        const MeshiMat4* transforms,
+        size_t first,
+        size_t count);
+    void (*gfx_release_instanced_render_object)(
+        struct MeshiEngine* render,
+        const MeshiInstanceGroupHandle* h);
+    int32_t (*get_memory_stats)(struct MeshiEngine* engine, struct MeshiMemoryStats* out_stats);
 } MeshiPluginApi;
 
 // Engine
@@ -106,6 +174,10 @@ struct MeshiEngine* meshi_make_engine_headless(const char* application_name, con
 void meshi_destroy_engine(struct MeshiEngine* engine);
 void meshi_register_event_callback(struct MeshiEngine* engine, void* user_data, MeshiEventCallback cb);
 float meshi_update(struct MeshiEngine* engine);
+// Copies the per-system timings of the last completed update into out_timings.
+int32_t meshi_get_frame_timings(struct MeshiEngine* engine, MeshiFrameTimings* out_timings);
+// Fills out_stats with per-system resource counts for memory triage.
+int32_t meshi_get_memory_stats(struct MeshiEngine* engine, struct MeshiMemoryStats* out_stats);
 struct MeshiEngine* meshi_get_graphics_system(struct MeshiEngine* engine);
 struct MeshiEngine* meshi_get_audio_system(struct MeshiEngine* engine);
 const struct MeshiPluginApi* meshi_plugin_get_api(void);
@@ -142,8 +214,58 @@ void meshi_audio_register_finished_callback(struct MeshiEngine* engine, void* us
 MESHI_DEPRECATED
 MeshiRenderObjectHandle meshi_gfx_create_mesh_object(struct MeshiEngine* render, const MeshiMeshObjectInfo* info);
 MeshiRenderObjectHandle meshi_gfx_create_render_object(struct MeshiEngine* render, const MeshiRenderObjectInfo* info);
+// Batch variant; returns the number of objects created.
+size_t meshi_gfx_create_render_objects(
+    struct MeshiEngine* render,
+    const MeshiRenderObjectInfo* infos,
+    MeshiRenderObjectHandle* out_handles,
+    size_t count);
+// Resolves a mesh name once; repeated calls return the same handle.
+MeshiMeshAssetHandle meshi_gfx_resolve_mesh(struct MeshiEngine* engine, const char* name);
+// Creates a renderable from a pre-resolved mesh handle; no string lookups.
+MeshiRenderObjectHandle meshi_gfx_create_render_object_from_mesh(
+    struct MeshiEngine* render,
+    MeshiMeshAssetHandle mesh,
+    const MeshiMat4* transform);
+// Queues a renderable whose asset loads inside later updates under a
+// per-frame budget; returns a ticket immediately.
+MeshiAsyncRenderLoadHandle meshi_gfx_create_render_object_async(
+    struct MeshiEngine* render,
+    const MeshiRenderObjectInfo* info);
+// Polls a ticket: 0 = pending, 1 = ready (handle written, ticket consumed),
+// -1 = invalid or already claimed.
+int32_t meshi_gfx_poll_async_render_object(
+    struct MeshiEngine* render,
+    MeshiAsyncRenderLoadHandle ticket,
+    MeshiRenderObjectHandle* out_handle);
+// Caps how many milliseconds each update spends completing queued loads.
+void meshi_gfx_set_async_load_budget(struct MeshiEngine* engine, float milliseconds);
+// Creates `count` instances of one mesh behind a single group handle; the
+// mesh resolves once and the transforms upload in one call.
+MeshiInstanceGroupHandle meshi_gfx_create_instanced_render_object(
+    struct MeshiEngine* render,
+    const MeshiRenderObjectInfo* info,
+    const MeshiMat4* instances,
+    size_t count);
+// Refreshes instances [first, first + count) of a group; the range is clamped
+// to the group's size. Returns the number of instances updated.
+size_t meshi_gfx_update_instance_transforms(
+    struct MeshiEngine* render,
+    MeshiInstanceGroupHandle group,
+    const MeshiMat4* transforms,
+    size_t first,
+    size_t count);
+// Releases a group and every instance it owns.
+void meshi_gfx_release_instanced_render_object(
+    struct MeshiEngine* render,
+    const MeshiInstanceGroupHandle* h);
 void meshi_gfx_release_render_object(struct MeshiEngine* render, const MeshiRenderObjectHandle* h);
 void meshi_gfx_set_transform(struct MeshiEngine* render, MeshiRenderObjectHandle h, const MeshiMat4* transform);
+void meshi_gfx_set_transforms(
+    struct MeshiEngine* render,
+    const MeshiRenderObjectHandle* handles,
+    const MeshiMat4* transforms,
+    size_t count);
 MeshiLightHandle meshi_gfx_create_light(struct MeshiEngine* render, const MeshiLightInfo* info);
 void meshi_gfx_release_light(struct MeshiEngine* render, const MeshiLightHandle* h);
 void meshi_gfx_set_light_transform(struct MeshiEngine* render, MeshiLightHandle h, const MeshiMat4* transform);
@@ -175,10 +297,43 @@ void meshi_physx_release_rigid_body(struct MeshiEngine* engine, const MeshiRigid
 void meshi_physx_apply_force_to_rigid_body(struct MeshiEngine* engine, const MeshiRigidBodyHandle* h, const MeshiForceApplyInfo* info);
 int32_t meshi_physx_set_rigid_body_transform(struct MeshiEngine* engine, const MeshiRigidBodyHandle* h, const MeshiActorStatus* info);
 int32_t meshi_physx_get_rigid_body_status(struct MeshiEngine* engine, const MeshiRigidBodyHandle* h, MeshiActorStatus* out_status);
+// Batch variant; returns the number of statuses written. Entries whose handle
+// is invalid are left untouched.
+size_t meshi_physx_get_rigid_body_statuses(
+    struct MeshiEngine* engine,
+    const MeshiRigidBodyHandle* handles,
+    MeshiActorStatus* out_statuses,
+    size_t count);
+// Runs the simulation on a fixed timestep; updates accumulate dt and step in
+// whole ticks. Zero restores variable stepping.
+void meshi_physx_set_fixed_timestep(struct MeshiEngine* engine, float step_secs);
+// Blend factor between the last two ticks (0 = previous, 1 = current);
+// always 1.0 under variable stepping.
+float meshi_physx_get_interpolation_alpha(struct MeshiEngine* engine);
+// Status blended between the last two simulation steps.
+int32_t meshi_physx_get_rigid_body_status_interpolated(
+    struct MeshiEngine* engine,
+    const MeshiRigidBodyHandle* h,
+    float alpha,
+    MeshiActorStatus* out_status);
+// Batch variant; returns the number of statuses written. Entries whose handle
+// is invalid are left untouched.
+size_t meshi_physx_get_rigid_body_statuses_interpolated(
+    struct MeshiEngine* engine,
+    const MeshiRigidBodyHandle* handles,
+    float alpha,
+    MeshiActorStatus* out_statuses,
+    size_t count);
 // Returns the current velocity of a rigid body or a zero vector on failure.
 MeshiVec3 meshi_physx_get_rigid_body_velocity(struct MeshiEngine* engine, const MeshiRigidBodyHandle* h);
 int32_t meshi_physx_set_collision_shape(struct MeshiEngine* engine, const MeshiRigidBodyHandle* h, const MeshiCollisionShape* shape);
 size_t meshi_physx_get_contacts(struct MeshiEngine* engine, MeshiContactInfo* out_contacts, size_t max);
+// Maps the plugin-owned contact snapshot for zero-copy reading and returns
+// its frame sequence number. The buffer is invalidated by the next update.
+uint64_t meshi_physx_map_contacts(
+    struct MeshiEngine* engine,
+    const MeshiContactInfo** out_contacts,
+    size_t* out_count);
 MeshiCollisionShape meshi_physx_collision_shape_sphere(float radius);
 MeshiCollisionShape meshi_physx_collision_shape_box(MeshiVec3 dimensions);
 MeshiCollisionShape meshi_physx_collision_shape_capsule(float half_height, float radius);
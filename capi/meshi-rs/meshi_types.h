@@ -5,6 +5,13 @@
 struct MeshiHandle {
     std::uint32_t slot;
     std::uint32_t generation;
+
+    bool valid() const {
+        return slot != 0xFFFFFFFFu && generation != 0xFFFFFFFFu;
+    }
+    bool operator==(const MeshiHandle& other) const {
+        return slot == other.slot && generation == other.generation;
+    }
 };
 
 struct MeshiVec2 {
@@ -322,6 +329,32 @@ struct MeshiRigidBodyInfo {
     MeshiCollisionShape collision_shape;
 };
 
+// Per-system timings for the most recent engine update, in milliseconds.
+struct MeshiFrameTimings {
+    float physics_ms;
+    float render_ms;
+    float audio_ms;
+    float total_ms;
+};
+
+// Per-system resource counts for leak triage over long sessions. Graphics
+// object/light counts track what crossed the FFI; the rest come straight from
+// the owning system's live pools.
+struct MeshiMemoryStats {
+    std::uint64_t gfx_render_objects;
+    std::uint64_t gfx_lights;
+    std::uint64_t gfx_resolved_models;
+    std::uint64_t gfx_async_load_slots;
+    std::uint64_t gfx_instance_groups;
+    std::uint64_t gfx_instanced_objects;
+    std::uint64_t physx_rigid_bodies;
+    std::uint64_t physx_materials;
+    std::uint64_t physx_contacts;
+    std::uint64_t audio_sources;
+    std::uint64_t audio_streams;
+    std::uint64_t audio_buses;
+};
+
 struct MeshiActorStatus {
     MeshiVec3 position;
     MeshiQuat rotation;
@@ -340,6 +373,9 @@ using MeshiMeshObjectHandle MESHI_DEPRECATED = MeshiRenderObjectHandle;
 #else
 typedef MeshiRenderObjectHandle MeshiMeshObjectHandle MESHI_DEPRECATED;
 #endif
+using MeshiMeshAssetHandle = MeshiHandle;
+using MeshiAsyncRenderLoadHandle = MeshiHandle;
+using MeshiInstanceGroupHandle = MeshiHandle;
 using MeshiLightHandle = MeshiHandle;
 using MeshiDisplayHandle = MeshiHandle;
 using MeshiCameraHandle = MeshiHandle;
@@ -21,11 +21,33 @@ set(MESHI_RS_PLUGIN_SOURCE
     "Path to the meshi-rs plugin build artifact.")
 
 option(MESHI_RS_COPY_PLUGIN "Copy meshi-rs plugin into the build output directory for local runs." ON)
+option(MESHI_PLUGIN_STATIC "Link the meshi-rs plugin statically instead of loading it at runtime." OFF)
+
+if (WIN32)
+  set(MESHI_RS_PLUGIN_STATIC_FILENAME "meshi.lib")
+else()
+  set(MESHI_RS_PLUGIN_STATIC_FILENAME "libmeshi.a")
+endif()
+
+set(MESHI_RS_PLUGIN_STATIC_SOURCE
+    "${MESHI_RS_DIR}/target/${MESHI_RS_PLUGIN_PROFILE}/${MESHI_RS_PLUGIN_STATIC_FILENAME}"
+    CACHE FILEPATH
+    "Path to the meshi-rs static plugin build artifact.")
 
 add_library(meshi-rs INTERFACE)
 target_include_directories(meshi-rs INTERFACE ${MESHI_RS_INCLUDE_DIR})
 
-if (MESHI_RS_COPY_PLUGIN)
+if (MESHI_PLUGIN_STATIC)
+  # The plugin is linked into the executable; MESHI_PLUGIN_LOAD_API binds the
+  # API table at link time, so no plugin file is loaded (or copied) at runtime.
+  target_compile_definitions(meshi-rs INTERFACE MESHI_PLUGIN_STATIC)
+  target_link_libraries(meshi-rs INTERFACE ${MESHI_RS_PLUGIN_STATIC_SOURCE})
+  if (UNIX AND NOT APPLE)
+    target_link_libraries(meshi-rs INTERFACE dl pthread m)
+  endif()
+endif()
+
+if (MESHI_RS_COPY_PLUGIN AND NOT MESHI_PLUGIN_STATIC)
   set(MESHI_RS_PLUGIN_DESTINATION
       "${CMAKE_RUNTIME_OUTPUT_DIRECTORY}/${MESHI_RS_PLUGIN_FILENAME}")
   set(MESHI_RS_PLUGIN_PATH "${MESHI_RS_PLUGIN_DESTINATION}")
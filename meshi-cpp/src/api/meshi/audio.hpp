@@ -0,0 +1,223 @@
+#pragma once
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <meshi.h>
+#include "meshi/types.hpp"
+#include <meshi/bits/util/slice.hpp>
+
+namespace meshi {
+
+// Preallocated single-producer single-consumer ring for streamed samples.
+// The pumping thread writes decoded bytes in place via writable_span() and
+// the consumer drains readable_span(); neither side allocates or stages
+// through an intermediate buffer after construction.
+class AudioStreamRing {
+public:
+  explicit AudioStreamRing(std::size_t capacity) {
+    std::size_t rounded = 1;
+    while (rounded < capacity) {
+      rounded <<= 1;
+    }
+    m_bytes.resize(rounded);
+  }
+
+  // Contiguous free region at the current write position. Fill it and call
+  // commit() to publish the bytes to the consumer. May be shorter than the
+  // total free space when the write position is near the wrap point.
+  auto writable_span() -> Slice<std::uint8_t> {
+    const auto head = m_head.load(std::memory_order_relaxed);
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    const auto mask = m_bytes.size() - 1;
+    const auto free_total = m_bytes.size() - (head - tail);
+    const auto to_end = m_bytes.size() - (head & mask);
+    return Slice<std::uint8_t>(m_bytes.data() + (head & mask),
+                               free_total < to_end ? free_total : to_end);
+  }
+
+  auto commit(std::size_t bytes) -> void {
+    m_head.store(m_head.load(std::memory_order_relaxed) + bytes,
+                 std::memory_order_release);
+  }
+
+  // Contiguous readable region at the current read position; consume() after
+  // mixing to release it back to the producer.
+  auto readable_span() -> Slice<const std::uint8_t> {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    const auto head = m_head.load(std::memory_order_acquire);
+    const auto mask = m_bytes.size() - 1;
+    const auto available = head - tail;
+    const auto to_end = m_bytes.size() - (tail & mask);
+    return Slice<const std::uint8_t>(m_bytes.data() + (tail & mask),
+                                     available < to_end ? available : to_end);
+  }
+
+  auto consume(std::size_t bytes) -> void {
+    m_tail.store(m_tail.load(std::memory_order_relaxed) + bytes,
+                 std::memory_order_release);
+  }
+
+  auto size() const -> std::size_t {
+    return m_head.load(std::memory_order_acquire) -
+           m_tail.load(std::memory_order_acquire);
+  }
+
+  auto capacity() const -> std::size_t { return m_bytes.size(); }
+
+private:
+  std::vector<std::uint8_t> m_bytes;
+  std::atomic<std::size_t> m_head{0};
+  std::atomic<std::size_t> m_tail{0};
+};
+
+class AudioSystem {
+public:
+  auto create_source(const char *path) -> Handle<audio::Source> {
+    return api_->audio_create_source(m_audio, path);
+  }
+
+  auto create_stream(const char *path) -> Handle<audio::Source> {
+    return api_->audio_create_stream(m_audio, path);
+  }
+
+  void destroy_source(Handle<audio::Source> &source) {
+    api_->audio_destroy_source(m_audio, source);
+  }
+
+  void play(Handle<audio::Source> source) { api_->audio_play(m_audio, source); }
+
+  void pause(Handle<audio::Source> source) {
+    api_->audio_pause(m_audio, source);
+  }
+
+  void stop(Handle<audio::Source> source) { api_->audio_stop(m_audio, source); }
+
+  auto state(Handle<audio::Source> source) -> audio::PlaybackState {
+    return api_->audio_get_state(m_audio, source);
+  }
+
+  void set_looping(Handle<audio::Source> source, bool looping) {
+    api_->audio_set_looping(m_audio, source, static_cast<int32_t>(looping));
+  }
+
+  void set_volume(Handle<audio::Source> source, float volume) {
+    api_->audio_set_volume(m_audio, source, volume);
+  }
+
+  void set_pitch(Handle<audio::Source> source, float pitch) {
+    api_->audio_set_pitch(m_audio, source, pitch);
+  }
+
+  void set_bus_volume(Handle<audio::Bus> bus, float volume) {
+    api_->audio_set_bus_volume(m_audio, bus, volume);
+  }
+
+  void register_finished_callback(void *user_data,
+                                  MeshiAudioFinishedCallback callback) {
+    api_->audio_register_finished_callback(m_audio, user_data, callback);
+  }
+
+  // Pumps decoded samples for a streaming source directly into the ring's
+  // free space. No per-chunk allocation and no staging copy; the plugin
+  // writes in place. Returns the number of bytes committed.
+  auto stream_into(Handle<audio::Source> source,
+                   AudioStreamRing &ring) -> std::size_t {
+    std::size_t total = 0;
+    // Two passes cover the wrap point: the first fills to the end of the
+    // buffer, the second starts over at the front if the stream had more.
+    for (int pass = 0; pass < 2; ++pass) {
+      auto span = ring.writable_span();
+      if (span.size() == 0) {
+        break;
+      }
+      const auto written =
+          api_->audio_update_stream(m_audio, source, span.data(), span.size());
+      ring.commit(written);
+      total += written;
+      if (written < span.size()) {
+        break;
+      }
+    }
+    return total;
+  }
+
+  // Queues a positional update for submission at the end of the frame, so
+  // spatial sources coalesce into one pass next to the listener update
+  // instead of scattered per-component calls. Safe to call from the parallel
+  // World::update workers.
+  void queue_source_transform(Handle<audio::Source> &source,
+                              const glm::mat4 &transform,
+                              const glm::vec3 &velocity) {
+    std::lock_guard<std::mutex> lock(*m_queue_mutex);
+    m_queued_sources.push_back(source);
+    m_queued_transforms.push_back(transform);
+    m_queued_velocities.push_back(velocity);
+  }
+
+  void set_listener(const glm::mat4 &transform, const glm::vec3 &velocity) {
+    std::lock_guard<std::mutex> lock(*m_queue_mutex);
+    m_listener_transform = transform;
+    m_listener_velocity = velocity;
+    m_listener_pending = true;
+  }
+
+  // Flushes the listener update and every queued source update in one pass.
+  // Called once per frame by the engine after the world has updated.
+  void flush_queued_updates() {
+    if (m_listener_pending) {
+      MeshiMat4 t = to_meshi_mat4(m_listener_transform);
+      api_->audio_set_listener_transform(
+          m_audio, &t,
+          {m_listener_velocity.x, m_listener_velocity.y,
+           m_listener_velocity.z});
+      m_listener_pending = false;
+    }
+    for (std::size_t i = 0; i < m_queued_sources.size(); ++i) {
+      MeshiMat4 t = to_meshi_mat4(m_queued_transforms[i]);
+      const auto &v = m_queued_velocities[i];
+      api_->audio_set_source_transform(m_audio, m_queued_sources[i], &t,
+                                       {v.x, v.y, v.z});
+    }
+    m_queued_sources.clear();
+    m_queued_transforms.clear();
+    m_queued_velocities.clear();
+  }
+
+private:
+  friend class EngineBackend;
+  AudioSystem() = default;
+  explicit AudioSystem(const MeshiPluginApi *api, RawAudioSystem *ptr)
+      : api_(api), m_audio(ptr) {}
+  ~AudioSystem() = default;
+  // Same shape as GraphicsSystem: the user-declared destructor suppresses
+  // the implicit moves and the mutex member deletes the copies, but
+  // EngineBackend move-assigns this wrapper during setup.
+  AudioSystem(AudioSystem &&) = default;
+  auto operator=(AudioSystem &&) -> AudioSystem & = default;
+
+  static MeshiMat4 to_meshi_mat4(const glm::mat4 &m) {
+    MeshiMat4 out{};
+    std::memcpy(out.m, glm::value_ptr(m), sizeof(MeshiMat4));
+    return out;
+  }
+
+  const MeshiPluginApi *api_{};
+  RawAudioSystem *m_audio{};
+  // Behind a pointer so AudioSystem stays movable during backend setup.
+  std::unique_ptr<std::mutex> m_queue_mutex = std::make_unique<std::mutex>();
+  std::vector<Handle<audio::Source>> m_queued_sources;
+  std::vector<glm::mat4> m_queued_transforms;
+  std::vector<glm::vec3> m_queued_velocities;
+  glm::mat4 m_listener_transform = glm::mat4(1.0f);
+  glm::vec3 m_listener_velocity{0.0f};
+  bool m_listener_pending = false;
+};
+
+} // namespace meshi
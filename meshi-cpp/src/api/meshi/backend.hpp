@@ -6,6 +6,7 @@
 #include <memory>
 #include <meshi.h>
 #include "meshi/types.hpp"
+#include <meshi/audio.hpp>
 #include <meshi/graphics.hpp>
 #include <meshi/physics.hpp>
 #include "meshi/bits/util/loader.hpp"
@@ -21,8 +22,10 @@ public:
 
     auto raw_phys = api_->get_physics_system(engine_);
     auto raw_gfx = api_->get_graphics_system(engine_);
+    auto raw_audio = api_->get_audio_system(engine_);
     m_phys = PhysicsSystem(api_, raw_phys);
     m_gfx = GraphicsSystem(api_, raw_gfx);
+    m_audio = AudioSystem(api_, raw_audio);
   }
 
   EngineBackend(const EngineBackend &) = delete;
@@ -31,6 +34,7 @@ public:
   EngineBackend(EngineBackend &&other) noexcept
       : m_phys(std::move(other.m_phys)),
         m_gfx(std::move(other.m_gfx)),
+        m_audio(std::move(other.m_audio)),
         engine_(other.engine_),
         api_(other.api_) {
     other.engine_ = nullptr;
@@ -45,6 +49,7 @@ public:
 
       m_phys = std::move(other.m_phys);
       m_gfx = std::move(other.m_gfx);
+      m_audio = std::move(other.m_audio);
       engine_ = other.engine_;
       api_ = other.api_;
 
@@ -68,11 +73,24 @@ public:
 
   float update() { return api_->update(engine_); }
 
+  // Per-system timings for the plugin's last completed update.
+  void get_frame_timings(MeshiFrameTimings *out) {
+    api_->get_frame_timings(engine_, out);
+  }
+
+  // Per-system resource counts from the plugin side of the boundary.
+  void get_memory_stats(MeshiMemoryStats *out) {
+    api_->get_memory_stats(engine_, out);
+  }
+
   inline auto physics() -> PhysicsSystem & { return m_phys; }
 
   inline auto graphics() -> GraphicsSystem & { return m_gfx; }
 
+  inline auto audio() -> AudioSystem & { return m_audio; }
+
 private:
+#ifndef MESHI_PLUGIN_STATIC
   static const char* plugin_path() {
 #ifdef MESHI_PLUGIN_PATH
     return MESHI_PLUGIN_PATH;
@@ -84,18 +102,26 @@ private:
     return "libmeshi.so";
 #endif
   }
+#endif
 
   static const MeshiPluginApi *resolve_api() {
+#ifdef MESHI_PLUGIN_STATIC
+    // The plugin is linked into the executable; the API table is bound at
+    // link time and there is nothing to dlopen.
+    return MESHI_PLUGIN_LOAD_API(nullptr);
+#else
     static void* dl = meshi::detail::loader_function(plugin_path());
     auto loader_fn = [](const char* name) {
       return meshi::detail::get_plugin_symbol(dl, name);
     };
 
     return MESHI_PLUGIN_LOAD_API(loader_fn);
+#endif
   }
 
   PhysicsSystem m_phys;
   GraphicsSystem m_gfx;
+  AudioSystem m_audio;
   RawEngineBackend *engine_{};
   const MeshiPluginApi *api_{};
 };
@@ -1,18 +1,24 @@
 #pragma once
 #include <meshi/bits/event.hpp>
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <glm/glm.hpp>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
 namespace meshi {
 
+// Interned identifier for an action type. Assigned once when the name is
+// first registered; dispatch never hashes or compares strings.
+using ActionId = std::uint32_t;
+
 // Struct representing an action
 struct Action {
-  std::string type; // Action type as a string
+  ActionId id = 0;
   Event event;
   uint32_t timestamp;
 };
@@ -52,11 +58,6 @@ private:
 
 class ActionHandler {
 public:
-  struct FilteredActionCallback {
-    std::string action_type;
-    ActionCallback callback;
-  };
-
   explicit ActionHandler(EventHandler &event_handler)
       : event_handler_(event_handler) {
     event_handler_.register_callback(
@@ -70,40 +71,80 @@ public:
     return ActionRegister<T>(*this, ptr);
   }
 
+  // Interns an action name, assigning a dense id on first use. Resolve once
+  // at setup time and hold the ActionId; the string-taking overloads below
+  // route through here so existing callers keep working.
+  auto action_id(const std::string &action_type) -> ActionId {
+    auto iter = ids_.find(action_type);
+    if (iter != ids_.end()) {
+      return iter->second;
+    }
+    auto id = static_cast<ActionId>(action_filters_.size());
+    ids_.emplace(action_type, id);
+    action_filters_.emplace_back();
+    action_callbacks_.emplace_back();
+    return id;
+  }
+
   void register_action(const std::string &action_type, ActionFilter filter) {
-    action_filters_[action_type] = std::move(filter);
+    action_filters_[action_id(action_type)] = std::move(filter);
+  }
+
+  void register_action_callback(ActionId id, ActionCallback callback) {
+    if (id < action_callbacks_.size()) {
+      action_callbacks_[id].push_back(std::move(callback));
+    }
   }
 
   void register_action_callback(const std::string &action_type,
                                 ActionCallback callback) {
-    action_callbacks_.emplace_back(
-        FilteredActionCallback{action_type, std::move(callback)});
+    register_action_callback(action_id(action_type), std::move(callback));
   }
 
   void unregister_action_callback(ActionCallback &callback) {
-    action_callbacks_.erase(
-        std::remove_if(action_callbacks_.begin(), action_callbacks_.end(),
-                       [&callback](FilteredActionCallback &fac) {
-                         return fac.callback.target<void(const Action &)>() ==
-                                callback.target<void(const Action &)>();
-                       }),
-        action_callbacks_.end());
+    for (auto &bucket : action_callbacks_) {
+      bucket.erase(
+          std::remove_if(bucket.begin(), bucket.end(),
+                         [&callback](ActionCallback &registered) {
+                           return registered.target<void(const Action &)>() ==
+                                  callback.target<void(const Action &)>();
+                         }),
+          bucket.end());
+    }
   }
 
+  // One pass over the dense filter table; a matching action invokes only its
+  // own id's callback bucket. No strings are hashed, compared, or copied.
   void process_event(const Event &event) {
-    for (const auto &[action_type, filter] : action_filters_) {
-      Action action{action_type, event, event.timestamp};
+    const auto count = static_cast<ActionId>(action_filters_.size());
+    for (ActionId id = 0; id < count; ++id) {
+      const auto &filter = action_filters_[id];
+      if (!filter) {
+        continue;
+      }
+      Action action{id, event, event.timestamp};
       if (filter(event, action)) {
-        for (const auto &[registered_action_type, callback] :
-             action_callbacks_) {
-          if (action_type == registered_action_type) {
-            callback(action);
-          }
+        for (const auto &callback : action_callbacks_[id]) {
+          callback(action);
         }
       }
     }
   }
 
+  // Interned action types; feeds the engine's memory accounting.
+  [[nodiscard]] auto action_type_count() const -> std::size_t {
+    return action_filters_.size();
+  }
+
+  // Registered callbacks across every action's bucket.
+  [[nodiscard]] auto callback_count() const -> std::size_t {
+    std::size_t count = 0;
+    for (const auto &bucket : action_callbacks_) {
+      count += bucket.size();
+    }
+    return count;
+  }
+
   static bool is_just_pressed(const Event &event, const Action &action) {
     return event.type == EventType::Pressed;
   }
@@ -114,10 +155,10 @@ public:
 
 private:
   EventHandler &event_handler_; // Reference to the EventHandler
-  std::unordered_map<std::string, ActionFilter>
-      action_filters_; // Map of action types to filters
-  std::vector<FilteredActionCallback>
-      action_callbacks_; // List of registered action callbacks
+  std::unordered_map<std::string, ActionId> ids_; // Interned action names
+  std::vector<ActionFilter> action_filters_;      // Indexed by ActionId
+  std::vector<std::vector<ActionCallback>>
+      action_callbacks_; // Callback buckets indexed by ActionId
 };
 
 template <typename T> ActionRegister<T>::~ActionRegister() {
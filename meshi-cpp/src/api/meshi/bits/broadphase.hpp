@@ -0,0 +1,128 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <unordered_map>
+#include <vector>
+namespace meshi {
+class Denizen;
+
+// Uniform spatial hash over collider AABBs. World rebuilds it once per frame
+// and queries it per denizen, so collision candidates are limited to entries
+// sharing a cell instead of every registered collider in the world.
+class Broadphase {
+public:
+  Broadphase() = default;
+
+  // Cell edge length. Works best near the size of a typical collider; too
+  // small and large AABBs touch many cells, too large and everything shares
+  // one.
+  inline auto set_cell_size(float size) -> void {
+    if (size > 0.0f) {
+      m_cell_size = size;
+    }
+  }
+
+  [[nodiscard]] inline auto cell_size() const -> float { return m_cell_size; }
+
+  // Drops all entries but keeps cell buckets allocated, so a steady-state
+  // rebuild each frame does not rehash or reallocate.
+  inline auto clear() -> void {
+    m_entries.clear();
+    m_stamps.clear();
+    for (auto &[key, bucket] : m_cells) {
+      bucket.clear();
+    }
+  }
+
+  inline auto insert(Denizen *owner, const glm::vec3 &min,
+                     const glm::vec3 &max) -> void {
+    const auto index = static_cast<std::uint32_t>(m_entries.size());
+    m_entries.push_back(Entry{owner, min, max});
+    m_stamps.push_back(0);
+    for_each_cell(min, max, [&](std::uint64_t key) {
+      m_cells[key].push_back(index);
+    });
+  }
+
+  // Gathers every owner whose AABB shares a cell with [min, max], deduped and
+  // excluding `self`. Results are appended to `out` after clearing it.
+  inline auto query(Denizen *self, const glm::vec3 &min, const glm::vec3 &max,
+                    std::vector<Denizen *> &out) -> void {
+    out.clear();
+    ++m_query_id;
+    for_each_cell(min, max, [&](std::uint64_t key) {
+      auto iter = m_cells.find(key);
+      if (iter == m_cells.end()) {
+        return;
+      }
+      for (auto index : iter->second) {
+        if (m_stamps[index] == m_query_id) {
+          continue;
+        }
+        m_stamps[index] = m_query_id;
+        auto &entry = m_entries[index];
+        if (entry.owner == self) {
+          continue;
+        }
+        if (min.x <= entry.max.x && max.x >= entry.min.x &&
+            min.y <= entry.max.y && max.y >= entry.min.y &&
+            min.z <= entry.max.z && max.z >= entry.min.z) {
+          out.push_back(entry.owner);
+        }
+      }
+    });
+  }
+
+private:
+  struct Entry {
+    Denizen *owner;
+    glm::vec3 min;
+    glm::vec3 max;
+  };
+
+  template <typename Fn>
+  inline auto for_each_cell(const glm::vec3 &min, const glm::vec3 &max,
+                            Fn fn) -> void {
+    const auto lo = cell_coord(min);
+    const auto hi = cell_coord(max);
+    for (std::int64_t z = lo.z; z <= hi.z; ++z) {
+      for (std::int64_t y = lo.y; y <= hi.y; ++y) {
+        for (std::int64_t x = lo.x; x <= hi.x; ++x) {
+          fn(cell_key(x, y, z));
+        }
+      }
+    }
+  }
+
+  struct CellCoord {
+    std::int64_t x;
+    std::int64_t y;
+    std::int64_t z;
+  };
+
+  inline auto cell_coord(const glm::vec3 &point) const -> CellCoord {
+    return CellCoord{
+        static_cast<std::int64_t>(std::floor(point.x / m_cell_size)),
+        static_cast<std::int64_t>(std::floor(point.y / m_cell_size)),
+        static_cast<std::int64_t>(std::floor(point.z / m_cell_size)),
+    };
+  }
+
+  static inline auto cell_key(std::int64_t x, std::int64_t y,
+                              std::int64_t z) -> std::uint64_t {
+    // Large-prime hash; collisions only cost a rejected narrow-phase test.
+    return static_cast<std::uint64_t>(x) * 73856093ull ^
+           static_cast<std::uint64_t>(y) * 19349663ull ^
+           static_cast<std::uint64_t>(z) * 83492791ull;
+  }
+
+  float m_cell_size = 4.0f;
+  std::uint64_t m_query_id = 0;
+  std::vector<Entry> m_entries;
+  // Last query that visited each entry; dedupes multi-cell hits without a set.
+  std::vector<std::uint64_t> m_stamps;
+  std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> m_cells;
+};
+} // namespace meshi
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <meshi/bits/components/base.hpp>
 namespace meshi {
 class ActorComponent : public Component {
@@ -17,32 +18,71 @@ public:
     }
   }
 
+  // Re-parenting changes the chain this component's cache was built from.
+  inline auto attach_to(Component *parent) -> void {
+    Component::attach_to(parent);
+    mark_world_dirty();
+  }
+
   inline auto front() -> glm::vec3 { return m_front; }
 
   inline auto right() -> glm::vec3 { return m_right; }
 
   inline auto up() -> glm::vec3 { return m_up; }
   inline auto local_transform() -> glm::mat4 & { return m_transform; }
-  inline auto world_transform() -> glm::mat4 {
-    if (auto ptr = m_parent->as_type<ActorComponent>()) {
-      return ptr->world_transform() * local_transform();
-    }
 
-    return local_transform();
+  // Cached parent-chain product, recomputed lazily. Unchanged subtrees cost a
+  // flag check instead of a chain of mat4 multiplies.
+  inline auto world_transform() -> const glm::mat4 & {
+    if (m_world_dirty) {
+      auto ptr =
+          m_parent != nullptr ? m_parent->as_type<ActorComponent>() : nullptr;
+      if (ptr != nullptr) {
+        m_world_transform = ptr->world_transform() * m_transform;
+      } else {
+        m_world_transform = m_transform;
+      }
+      m_world_dirty = false;
+    }
+    return m_world_transform;
   }
 
   inline auto set_transform(glm::mat4 &transform) -> void {
     m_right = glm::vec3(transform[0]);
-    m_up = glm::vec3(transform[1]);   
+    m_up = glm::vec3(transform[1]);
     m_front = -glm::vec3(transform[2]);
     m_transform = transform;
+    mark_world_dirty();
   }
 
+  // Invalidates the cached world transform here and in every ActorComponent
+  // below. A dirty node implies a dirty subtree (recomputing a child always
+  // refreshes its parents first), so an already-dirty node can stop early.
+  inline auto mark_world_dirty() -> void {
+    if (m_world_dirty) {
+      return;
+    }
+    m_world_dirty = true;
+    ++m_world_version;
+    for (auto *child : m_children) {
+      if (auto ptr = child->as_type<ActorComponent>()) {
+        ptr->mark_world_dirty();
+      }
+    }
+  }
+
+  // Bumped on every invalidation; cheap change detection for consumers that
+  // mirror this transform elsewhere.
+  inline auto world_version() const -> std::uint32_t { return m_world_version; }
+
 private:
   friend class Actor;
   glm::mat4 m_transform = glm::mat4(1.0);
+  glm::mat4 m_world_transform = glm::mat4(1.0);
   glm::vec3 m_front = {0.0, 0.0, 1.0};
   glm::vec3 m_right = {1.0, 0.0, 0.0};
   glm::vec3 m_up = {0.0, 1.0, 0.0};
+  std::uint32_t m_world_version = 0;
+  bool m_world_dirty = true;
 };
 } // namespace meshi
@@ -0,0 +1,69 @@
+#pragma once
+#include "meshi/bits/components/actor_component.hpp"
+#include "meshi/engine.hpp"
+namespace meshi {
+class AudioSourceComponent : public ActorComponent {
+public:
+  struct CreateInfo {
+    const char *path = "";
+    bool looping = false;
+    float volume = 1.0f;
+    // Streamed sources decode incrementally; pump them with
+    // AudioSystem::stream_into instead of loading the whole file.
+    bool stream = false;
+  };
+
+  AudioSourceComponent(CreateInfo info) {
+    auto &audio = engine()->backend().audio();
+    m_handle = info.stream ? audio.create_stream(info.path)
+                           : audio.create_source(info.path);
+    audio.set_looping(m_handle, info.looping);
+    audio.set_volume(m_handle, info.volume);
+  }
+
+  //////////////////////////////////////////////////////
+  ////VIRTUAL FUNCITONS/////////////////////////////////
+  //////////////////////////////////////////////////////
+
+  virtual ~AudioSourceComponent() {
+    engine()->backend().audio().destroy_source(m_handle);
+  }
+
+  virtual auto update(float dt) -> void {
+    ActorComponent::update(dt);
+    // Positional updates coalesce into the audio system's once-per-frame
+    // flush, and only when the transform moved since the last submit.
+    if (world_version() == m_submitted_version) {
+      return;
+    }
+    auto transform = world_transform();
+    const auto position = glm::vec3(transform[3]);
+    const auto velocity = m_has_last_position && dt > 0.0f
+                              ? (position - m_last_position) / dt
+                              : glm::vec3(0.0f);
+    m_last_position = position;
+    m_has_last_position = true;
+    m_submitted_version = world_version();
+    engine()->backend().audio().queue_source_transform(m_handle, transform,
+                                                       velocity);
+  }
+
+  //////////////////////////////////////////////////////
+  ////NON-VIRTUAL FUNCTIONS/////////////////////////////
+  //////////////////////////////////////////////////////
+
+  inline auto play() -> void { engine()->backend().audio().play(m_handle); }
+  inline auto pause() -> void { engine()->backend().audio().pause(m_handle); }
+  inline auto stop() -> void { engine()->backend().audio().stop(m_handle); }
+  inline auto state() -> audio::PlaybackState {
+    return engine()->backend().audio().state(m_handle);
+  }
+  inline auto handle() -> Handle<audio::Source> { return m_handle; }
+
+protected:
+  Handle<audio::Source> m_handle;
+  glm::vec3 m_last_position{0.0f};
+  std::uint32_t m_submitted_version = ~std::uint32_t(0);
+  bool m_has_last_position = false;
+};
+} // namespace meshi
@@ -25,7 +25,6 @@ public:
         [](const meshi::Event &event, meshi::Action &action) {
           if (event.source == meshi::EventSource::Mouse &&
               event.type == meshi::EventType::Motion2D) {
-            action.type = "movement";
             return true;
           }
           return false;
@@ -8,6 +8,11 @@ struct ModelComponentCreateInfo {
   const char *material = "";
   glm::mat4 transform = glm::mat4(1.0f);
   RigidBodyCreateInfo rigid_body_info{};
+  // Stream the model in on the plugin's budgeted async path instead of
+  // loading it inside the spawn.
+  bool async = false;
+  // Bounding-sphere radius for the CPU frustum cull; zero disables culling.
+  float cull_radius = 0.0f;
 };
 class ModelComponent : public RenderableComponent {
 public:
@@ -17,7 +22,8 @@ public:
                                  .mesh = info.model,
                                  .material = info.material,
                                  .transform = info.transform,
+                                 .cull_radius = info.cull_radius,
                              },
-                             info.rigid_body_info}) {}
+                             info.rigid_body_info, info.async}) {}
 };
 } // namespace meshi
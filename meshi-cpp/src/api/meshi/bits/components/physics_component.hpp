@@ -16,17 +16,21 @@ public:
     };
 
     m_handle = engine()->backend().physics().create_rigid_body(info);
+    engine()->backend().physics().track_rigid_body(m_handle);
   }
 
   PhysicsComponent(CreateInfo info) {
     m_handle = engine()->backend().physics().create_rigid_body(info);
+    engine()->backend().physics().track_rigid_body(m_handle);
   }
 
   //////////////////////////////////////////////////////
   ////VIRTUAL FUNCITONS/////////////////////////////////
   //////////////////////////////////////////////////////
 
-  virtual ~PhysicsComponent() = default;
+  virtual ~PhysicsComponent() {
+    engine()->backend().physics().untrack_rigid_body(m_handle);
+  }
 
   virtual auto update(float dt) -> void {
     ActorComponent::update(dt);
@@ -35,10 +39,20 @@ public:
     if (root) {
       auto c = root->as_type<ActorComponent>();
       if (c) {
-        auto status = engine()->backend().physics().get_rigid_body_status(m_handle);
-        auto mat = glm::translate(glm::mat4(1.0f), status.position) *
-                   glm::toMat4(status.rotation);
-        c->set_transform(mat);
+        // Served from the cache refreshed once per frame by the engine's
+        // batched readback; no plugin crossing per component.
+        auto status = engine()->backend().physics().cached_status(m_handle);
+        // Sleeping and static bodies report the same status every frame;
+        // skip the matrix rebuild and transform invalidation for those.
+        if (!m_has_last_status || status.position != m_last_position ||
+            status.rotation != m_last_rotation) {
+          auto mat = glm::translate(glm::mat4(1.0f), status.position) *
+                     glm::toMat4(status.rotation);
+          c->set_transform(mat);
+          m_last_position = status.position;
+          m_last_rotation = status.rotation;
+          m_has_last_status = true;
+        }
       }
     }
   }
@@ -49,5 +63,8 @@ public:
 
 protected:
   Handle<RigidBody> m_handle;
+  glm::vec3 m_last_position = {};
+  glm::quat m_last_rotation = {};
+  bool m_has_last_status = false;
 };
 } // namespace meshi
@@ -9,21 +9,76 @@ public:
   struct CreateInfo {
     gfx::RenderableCreateInfo render_info;
     RigidBodyCreateInfo rigid_body_info{};
+    // Load the asset on the plugin's budgeted async path; the renderable
+    // appears once it is live instead of the spawn stalling on disk I/O.
+    bool async = false;
   };
 
   RenderableComponent(CreateInfo info) : PhysicsComponent(info.rigid_body_info) {
-    m_handle = engine()->backend().graphics().create_renderable(info.render_info);
+    if (info.async) {
+      m_ticket =
+          engine()->backend().graphics().create_renderable_async(info.render_info);
+      m_async_pending = true;
+    } else {
+      m_handle = engine()->backend().graphics().create_renderable(info.render_info);
+    }
+    if (info.render_info.cull_radius > 0.0f) {
+      m_cull_index = engine()->backend().graphics().culler().register_sphere(
+          glm::vec3(info.render_info.transform[3]), info.render_info.cull_radius);
+    }
   }
 
   virtual auto update(float dt) -> void override {
     PhysicsComponent::update(dt);
+    if (m_async_pending && !claim_async()) {
+      return;
+    }
+    // Only queue a submit when the transform was invalidated since the last
+    // one; static scenery on sleeping bodies costs a version compare and a
+    // quiet frame pushes nothing across the FFI.
+    if (world_version() == m_submitted_version) {
+      return;
+    }
     auto transform = this->world_transform();
-    engine()->backend().graphics().set_transform(m_handle, transform);
+    if (m_cull_index != ~std::uint32_t(0)) {
+      auto &culler = engine()->backend().graphics().culler();
+      culler.update_sphere(m_cull_index, glm::vec3(transform[3]));
+      // Off-screen: skip the submit but stay dirty, so the renderable
+      // resubmits its latest transform the frame it comes back into view.
+      if (!culler.visible(m_cull_index)) {
+        return;
+      }
+    }
+    m_submitted_version = world_version();
+    engine()->backend().graphics().queue_transform(m_handle, transform);
   }
 
-  virtual ~RenderableComponent() = default;
+  virtual ~RenderableComponent() {
+    if (m_cull_index != ~std::uint32_t(0)) {
+      engine()->backend().graphics().culler().release_sphere(m_cull_index);
+    }
+  }
 
 protected:
+  // Claims the async renderable once the plugin finished loading it. Returns
+  // false while the asset is still pending.
+  auto claim_async() -> bool {
+    Handle<gfx::Renderable> h{};
+    if (engine()->backend().graphics().poll_renderable(m_ticket, &h) !=
+        gfx::AsyncLoadState::Ready) {
+      return false;
+    }
+    m_handle = h;
+    m_async_pending = false;
+    // Force a transform submit now that the renderable exists.
+    m_submitted_version = ~std::uint32_t(0);
+    return true;
+  }
+
   Handle<gfx::Renderable> m_handle;
+  Handle<gfx::AsyncRenderable> m_ticket{};
+  std::uint32_t m_submitted_version = ~std::uint32_t(0);
+  std::uint32_t m_cull_index = ~std::uint32_t(0);
+  bool m_async_pending = false;
 };
 } // namespace meshi
@@ -1,10 +1,14 @@
 #pragma once
 #include "meshi/backend.hpp"
+#include <meshi/bits/util/profiler.hpp>
+#include <meshi/bits/util/slice.hpp>
 #include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
 #include <functional>
 #include <glm/glm.hpp>
 #include <memory>
-#include <unordered_map>
 #include <vector>
 namespace meshi {
 using vec2 = glm::vec2;
@@ -181,6 +185,14 @@ struct Event {
   uint32_t timestamp;
 };
 
+// POD descriptor matching events on type/source/key without invoking a filter
+// closure. Unknown/Undefined fields match any value.
+struct EventMatch {
+  EventType type = EventType::Unknown;
+  EventSource source = EventSource::Unknown;
+  KeyCode key = KeyCode::Undefined;
+};
+
 // Define a filter function type for events
 using EventFilter = std::function<bool(const Event &)>;
 
@@ -200,6 +212,11 @@ public:
   inline auto register_event(EventFilter filter,
                              EventCallback callback) -> void;
 
+  inline auto register_event(EventMatch match,
+                             void (T::*callback)(const Event &)) -> void;
+
+  inline auto register_event(EventMatch match, EventCallback callback) -> void;
+
 private:
   friend class EventHandler;
   EventRegister(EventHandler &handler, T *instance)
@@ -258,74 +275,205 @@ public:
     return EventRegister<T>(*this, ptr);
   }
 
+  // Structure to hold a POD match and its corresponding callback
+  struct MatchedCallback {
+    EventMatch match;
+    EventCallback callback;
+  };
+
+  static constexpr std::size_t KEY_COUNT =
+      static_cast<std::size_t>(KeyCode::Undefined) + 1;
+  static constexpr std::size_t BUTTON_COUNT =
+      static_cast<std::size_t>(MouseButton::Right) + 1;
+
   // Register a new callback with a filter
   void register_callback(EventFilter filter, EventCallback callback) {
     callbacks_.emplace_back(
         FilteredCallback{std::move(filter), std::move(callback)});
   }
 
+  // Register a callback routed by a POD match descriptor instead of a filter
+  // closure. Callbacks that name a key go into a per-key table so key events
+  // dispatch via direct lookup rather than running every filter.
+  void register_callback(EventMatch match, EventCallback callback) {
+    if (match.key != KeyCode::Undefined) {
+      key_table_[static_cast<std::size_t>(match.key)].emplace_back(
+          MatchedCallback{match, std::move(callback)});
+    } else {
+      match_callbacks_.emplace_back(MatchedCallback{match, std::move(callback)});
+    }
+  }
+
   // Unregister a callback by providing its pointer
   void unregister_callback(EventCallback &callback) {
+    auto same_target = [&callback](EventCallback &other) {
+      return other.target<void(const Event &)>() ==
+             callback.target<void(const Event &)>();
+    };
     callbacks_.erase(
         std::remove_if(callbacks_.begin(), callbacks_.end(),
-                       [&callback](FilteredCallback &fc) {
-                         return fc.callback.target<void(const Event &)>() ==
-                                callback.target<void(const Event &)>();
+                       [&same_target](FilteredCallback &fc) {
+                         return same_target(fc.callback);
                        }),
         callbacks_.end());
+    match_callbacks_.erase(
+        std::remove_if(match_callbacks_.begin(), match_callbacks_.end(),
+                       [&same_target](MatchedCallback &mc) {
+                         return same_target(mc.callback);
+                       }),
+        match_callbacks_.end());
+    for (auto &bucket : key_table_) {
+      bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
+                                  [&same_target](MatchedCallback &mc) {
+                                    return same_target(mc.callback);
+                                  }),
+                   bucket.end());
+    }
+  }
+
+  // Switches event delivery from immediate callback dispatch to a polled,
+  // double-buffered queue. While polled, backend.update() only converts and
+  // enqueues events; poll_events() then hands the frame's batch to game code
+  // as one contiguous slice, and the key/button state updates there too — at
+  // the sync point, not during the pump.
+  inline auto set_polled(bool polled) -> void { polled_ = polled; }
+  [[nodiscard]] inline auto polled() const -> bool { return polled_; }
+
+  // Swaps the double buffer and returns every event captured since the last
+  // poll. The slice is valid until the next poll_events() call.
+  inline auto poll_events() -> Slice<Event> {
+    queued_front_.swap(queued_back_);
+    queued_back_.clear();
+    // The batch's deferred state transitions. In pipelined mode the backend
+    // pumps events concurrently with the world tick, so the bitsets — read
+    // by is_pressed/is_released from actor updates — may only change here,
+    // after the world sync, like the callbacks.
+    for (const auto &event : queued_front_) {
+      track_state(event);
+    }
+    return Slice<Event>(queued_front_);
   }
 
   // Process an event (called by the global callback)
   void process_event(const Event &event) {
+    auto timer =
+        detail::frame_profiler().time(detail::frame_profiler().current().event_ms);
+    if (polled_) {
+      // State tracking is deferred to poll_events(): while polled, the pump
+      // may run concurrently with gameplay code that reads the bitsets.
+      queued_back_.push_back(event);
+      return;
+    }
+    dispatch(event);
+    track_state(event);
+  }
+
+  // Runs the filter and match callback chains for one event. Polled consumers
+  // can call this per event from the slice if they still want handler-based
+  // dispatch for a subset of the batch.
+  void dispatch(const Event &event) {
     for (const auto &[filter, callback] : callbacks_) {
       if (filter(event)) {
         callback(event);
       }
     }
 
-    if (event.source == EventSource::MouseButton) {
-      MouseButton button = event.payload.mouse_button.button;
-      if (event.type == EventType::Pressed) {
-        pressed_buttons_[button] = true;
-      } else if (event.type == EventType::Released) {
-        pressed_buttons_[button] = false;
+    if (event.source == EventSource::Key) {
+      const auto key = static_cast<std::size_t>(event.payload.press.key);
+      if (key < KEY_COUNT) {
+        for (const auto &[match, callback] : key_table_[key]) {
+          if (matches(match, event)) {
+            callback(event);
+          }
+        }
       }
-    } else if (event.source == EventSource::Key) {
-      KeyCode key = event.payload.press.key;
-      if (event.type == EventType::Pressed) {
-        pressed_keys_[key] = true;
-      } else if (event.type == EventType::Released) {
-        pressed_keys_[key] = false;
+    }
+    for (const auto &[match, callback] : match_callbacks_) {
+      if (matches(match, event)) {
+        callback(event);
       }
     }
   }
 
+  // Registered callbacks across the filter, match, and per-key tables; feeds
+  // the engine's memory accounting.
+  [[nodiscard]] auto callback_count() const -> std::size_t {
+    auto count = callbacks_.size() + match_callbacks_.size();
+    for (const auto &bucket : key_table_) {
+      count += bucket.size();
+    }
+    return count;
+  }
+
   bool is_pressed(MouseButton button) const {
-    auto it = pressed_buttons_.find(button);
-    return it != pressed_buttons_.end() && it->second;
+    const auto i = static_cast<std::size_t>(button);
+    return i < BUTTON_COUNT && pressed_buttons_[i];
   }
 
   bool is_released(MouseButton button) const {
-    auto it = pressed_buttons_.find(button);
-    return it != pressed_buttons_.end() && !it->second;
+    const auto i = static_cast<std::size_t>(button);
+    return i < BUTTON_COUNT && seen_buttons_[i] && !pressed_buttons_[i];
   }
 
   bool is_pressed(KeyCode key) const {
-    auto it = pressed_keys_.find(key);
-    return it != pressed_keys_.end() && it->second;
+    const auto i = static_cast<std::size_t>(key);
+    return i < KEY_COUNT && pressed_keys_[i];
   }
 
   bool is_released(KeyCode key) const {
-    auto it = pressed_keys_.find(key);
-    return it != pressed_keys_.end() && !it->second;
+    const auto i = static_cast<std::size_t>(key);
+    return i < KEY_COUNT && seen_keys_[i] && !pressed_keys_[i];
   }
 
 private:
+  void track_state(const Event &event) {
+    if (event.source == EventSource::MouseButton) {
+      const auto button =
+          static_cast<std::size_t>(event.payload.mouse_button.button);
+      if (button < BUTTON_COUNT) {
+        seen_buttons_[button] = true;
+        pressed_buttons_[button] = event.type == EventType::Pressed;
+      }
+    } else if (event.source == EventSource::Key) {
+      const auto key = static_cast<std::size_t>(event.payload.press.key);
+      if (key < KEY_COUNT) {
+        seen_keys_[key] = true;
+        pressed_keys_[key] = event.type == EventType::Pressed;
+      }
+    }
+  }
+
+  static bool matches(const EventMatch &match, const Event &event) {
+    if (match.type != EventType::Unknown && match.type != event.type) {
+      return false;
+    }
+    if (match.source != EventSource::Unknown && match.source != event.source) {
+      return false;
+    }
+    if (match.key != KeyCode::Undefined &&
+        (event.source != EventSource::Key ||
+         event.payload.press.key != match.key)) {
+      return false;
+    }
+    return true;
+  }
+
   EngineBackend *engine_; // Pointer to the Meshi engine backend
-  std::unordered_map<MouseButton, bool> pressed_buttons_;
-  std::unordered_map<KeyCode, bool> pressed_keys_;
+  std::bitset<BUTTON_COUNT> pressed_buttons_;
+  std::bitset<BUTTON_COUNT> seen_buttons_;
+  std::bitset<KEY_COUNT> pressed_keys_;
+  std::bitset<KEY_COUNT> seen_keys_;
   std::vector<FilteredCallback>
       callbacks_; // List of registered callbacks with filters
+  std::vector<MatchedCallback>
+      match_callbacks_; // Match-routed callbacks without a key
+  std::array<std::vector<MatchedCallback>, KEY_COUNT>
+      key_table_; // Match-routed callbacks indexed by key
+  bool polled_ = false;
+  // Double buffer for polled mode: the backend fills the back buffer during
+  // update(), poll_events() swaps it to the front for iteration.
+  std::vector<Event> queued_back_;
+  std::vector<Event> queued_front_;
 };
 
 template <typename T> EventRegister<T>::~EventRegister() {
@@ -356,4 +504,22 @@ inline auto EventRegister<T>::register_event(EventFilter filter,
   registered_function_callbacks_.push_back(callback);
 }
 
+template <typename T>
+inline auto
+EventRegister<T>::register_event(EventMatch match,
+                                 void (T::*callback)(const Event &)) -> void {
+  auto bound_callback = [this, callback](const Event &event) {
+    (instance_->*callback)(event);
+  };
+  handler_.register_callback(match, bound_callback);
+  registered_callbacks_.push_back(bound_callback);
+}
+
+template <typename T>
+inline auto EventRegister<T>::register_event(EventMatch match,
+                                             EventCallback callback) -> void {
+  handler_.register_callback(match, callback);
+  registered_function_callbacks_.push_back(callback);
+}
+
 } // namespace meshi
@@ -0,0 +1,176 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+#if defined(__SSE2__) || (defined(_M_X64) && !defined(_M_ARM64EC))
+#define MESHI_CULL_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define MESHI_CULL_NEON 1
+#include <arm_neon.h>
+#endif
+namespace meshi {
+
+// View frustum as six inward-facing planes, extracted from a combined
+// view-projection matrix (Gribb/Hartmann). Planes are normalized so signed
+// distances compare directly against sphere radii.
+struct Frustum {
+  // plane = (a, b, c, d) with a*x + b*y + c*z + d >= 0 inside.
+  glm::vec4 planes[6];
+
+  static inline auto from_view_projection(const glm::mat4 &m) -> Frustum {
+    Frustum out;
+    // glm is column-major: row(i)[j] == m[j][i].
+    auto row = [&](int i) {
+      return glm::vec4(m[0][i], m[1][i], m[2][i], m[3][i]);
+    };
+    out.planes[0] = row(3) + row(0); // left
+    out.planes[1] = row(3) - row(0); // right
+    out.planes[2] = row(3) + row(1); // bottom
+    out.planes[3] = row(3) - row(1); // top
+    out.planes[4] = row(3) + row(2); // near
+    out.planes[5] = row(3) - row(2); // far
+    for (auto &plane : out.planes) {
+      auto len = glm::length(glm::vec3(plane));
+      if (len > 0.0f) {
+        plane /= len;
+      }
+    }
+    return out;
+  }
+};
+
+// Bounding spheres for every registered renderable, kept as contiguous
+// structure-of-arrays so the per-frame cull pass streams them through 4-wide
+// SSE/NEON plane tests (scalar fallback elsewhere). Slots are recycled, and
+// everything reads as visible until the first pass runs.
+class FrustumCuller {
+public:
+  FrustumCuller() = default;
+
+  inline auto register_sphere(const glm::vec3 &center,
+                              float radius) -> std::uint32_t {
+    std::uint32_t index;
+    if (!m_free.empty()) {
+      index = m_free.back();
+      m_free.pop_back();
+    } else {
+      index = static_cast<std::uint32_t>(m_x.size());
+      m_x.push_back(0.0f);
+      m_y.push_back(0.0f);
+      m_z.push_back(0.0f);
+      m_radius.push_back(0.0f);
+      m_visible.push_back(1);
+    }
+    m_x[index] = center.x;
+    m_y[index] = center.y;
+    m_z[index] = center.z;
+    m_radius[index] = radius;
+    m_visible[index] = 1;
+    return index;
+  }
+
+  inline auto update_sphere(std::uint32_t index,
+                            const glm::vec3 &center) -> void {
+    m_x[index] = center.x;
+    m_y[index] = center.y;
+    m_z[index] = center.z;
+  }
+
+  inline auto set_radius(std::uint32_t index, float radius) -> void {
+    m_radius[index] = radius;
+  }
+
+  // Freed slots report visible so a recycled index never inherits a stale
+  // cull result.
+  inline auto release_sphere(std::uint32_t index) -> void {
+    m_visible[index] = 1;
+    m_free.push_back(index);
+  }
+
+  [[nodiscard]] inline auto visible(std::uint32_t index) const -> bool {
+    return m_visible[index] != 0;
+  }
+
+  inline auto mark_all_visible() -> void {
+    for (auto &v : m_visible) {
+      v = 1;
+    }
+  }
+
+  // Tests every registered sphere against the frustum and records the
+  // results for visible(). Free-list slots get retested harmlessly; nobody
+  // reads their bit.
+  inline auto run(const Frustum &frustum) -> void {
+    const auto count = m_x.size();
+    std::size_t i = 0;
+#if defined(MESHI_CULL_SSE2)
+    for (; i + 4 <= count; i += 4) {
+      auto x = _mm_loadu_ps(&m_x[i]);
+      auto y = _mm_loadu_ps(&m_y[i]);
+      auto z = _mm_loadu_ps(&m_z[i]);
+      auto neg_r = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&m_radius[i]));
+      auto inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+      for (const auto &plane : frustum.planes) {
+        auto dist = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.x), x),
+                       _mm_mul_ps(_mm_set1_ps(plane.y), y)),
+            _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.z), z),
+                       _mm_set1_ps(plane.w)));
+        inside = _mm_and_ps(inside, _mm_cmpge_ps(dist, neg_r));
+      }
+      auto mask = _mm_movemask_ps(inside);
+      m_visible[i + 0] = static_cast<std::uint8_t>(mask & 1);
+      m_visible[i + 1] = static_cast<std::uint8_t>((mask >> 1) & 1);
+      m_visible[i + 2] = static_cast<std::uint8_t>((mask >> 2) & 1);
+      m_visible[i + 3] = static_cast<std::uint8_t>((mask >> 3) & 1);
+    }
+#elif defined(MESHI_CULL_NEON)
+    for (; i + 4 <= count; i += 4) {
+      auto x = vld1q_f32(&m_x[i]);
+      auto y = vld1q_f32(&m_y[i]);
+      auto z = vld1q_f32(&m_z[i]);
+      auto neg_r = vnegq_f32(vld1q_f32(&m_radius[i]));
+      auto inside = vdupq_n_u32(0xFFFFFFFFu);
+      for (const auto &plane : frustum.planes) {
+        auto dist = vmlaq_f32(
+            vmlaq_f32(vdupq_n_f32(plane.w), vdupq_n_f32(plane.x), x),
+            vdupq_n_f32(plane.y), y);
+        dist = vmlaq_f32(dist, vdupq_n_f32(plane.z), z);
+        inside = vandq_u32(inside, vcgeq_f32(dist, neg_r));
+      }
+      std::uint32_t lanes[4];
+      vst1q_u32(lanes, inside);
+      m_visible[i + 0] = static_cast<std::uint8_t>(lanes[0] & 1);
+      m_visible[i + 1] = static_cast<std::uint8_t>(lanes[1] & 1);
+      m_visible[i + 2] = static_cast<std::uint8_t>(lanes[2] & 1);
+      m_visible[i + 3] = static_cast<std::uint8_t>(lanes[3] & 1);
+    }
+#endif
+    for (; i < count; ++i) {
+      m_visible[i] = sphere_inside(frustum, i) ? 1 : 0;
+    }
+  }
+
+private:
+  inline auto sphere_inside(const Frustum &frustum,
+                            std::size_t i) const -> bool {
+    for (const auto &plane : frustum.planes) {
+      auto dist = plane.x * m_x[i] + plane.y * m_y[i] + plane.z * m_z[i] +
+                  plane.w;
+      if (dist < -m_radius[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::vector<float> m_x;
+  std::vector<float> m_y;
+  std::vector<float> m_z;
+  std::vector<float> m_radius;
+  std::vector<std::uint8_t> m_visible;
+  std::vector<std::uint32_t> m_free;
+};
+} // namespace meshi
@@ -1,19 +1,72 @@
 #pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 #include <meshi/bits/objects/base.hpp>
 #include <meshi/bits/components/actor_component.hpp>
 namespace meshi {
 
+// Tick-rate LOD tier. World::update walks only the buckets that are due each
+// frame, so actors far from anything interesting can run at a fraction of the
+// frame rate; their update(dt) still receives the full elapsed time since
+// their last tick.
+enum class TickRate : std::uint8_t {
+  EveryFrame = 0,
+  EveryFourthFrame = 1,
+  EverySixteenthFrame = 2,
+};
+
+// Interned attachment-point (socket) name. Resolve once at setup and query
+// with the id every frame; equal names always intern to the same id.
+struct AttachmentId {
+  std::uint32_t value = ~std::uint32_t(0);
+
+  [[nodiscard]] inline auto valid() const -> bool {
+    return value != ~std::uint32_t(0);
+  }
+  inline auto operator==(const AttachmentId &other) const -> bool {
+    return value == other.value;
+  }
+};
+
+namespace detail {
+inline auto attachment_name_table()
+    -> std::unordered_map<std::string, std::uint32_t> & {
+  static auto table = std::unordered_map<std::string, std::uint32_t>();
+  return table;
+}
+} // namespace detail
+
+// Resolves a socket name ("hand_r", "muzzle") to its interned id. This is the
+// only place the name is hashed — cache the id and hand it to the per-frame
+// queries instead of calling this in a hot loop.
+inline auto attachment_id(std::string_view name) -> AttachmentId {
+  auto &table = detail::attachment_name_table();
+  auto key = std::string(name);
+  auto iter = table.find(key);
+  if (iter == table.end()) {
+    iter = table
+               .emplace(std::move(key), static_cast<std::uint32_t>(table.size()))
+               .first;
+  }
+  return AttachmentId{iter->second};
+}
+
 // Object type
 // Represents any object in the scene.
 class Actor : public Object {
 public:
   Actor() {
-    m_root_component = std::make_shared<ActorComponent>();
+    m_root_component = detail::object_arena().create<ActorComponent>();
     m_root_component->m_actor = this;
   };
 
-  virtual ~Actor() = default;
+  virtual ~Actor() {
+    detail::object_arena().destroy(m_root_component);
+    m_root_component = nullptr;
+  }
   virtual auto update(float dt) -> void {
     if (m_root_component) {
       m_root_component->update(dt);
@@ -40,52 +93,164 @@ public:
   inline auto up() -> glm::vec3 {return m_root_component->up();}
   inline auto right() -> glm::vec3 {return m_root_component->right();}
   inline auto front() -> glm::vec3 {return m_root_component->front();}
-  inline auto local_transform() -> glm::mat4  { return m_root_component->world_transform(); }
-  inline auto world_transform() -> glm::mat4 {
+  inline auto local_transform() -> const glm::mat4 & {
+    return m_root_component->world_transform();
+  }
+
+  // Cached actor-chain product. Actors have no child registry, so instead of
+  // pushing dirty flags down, each actor pulls: it recomputes only when the
+  // root component's or the parent actor's version moved since the last query.
+  // The lazy write is unsynchronized: during parallel World updates only this
+  // actor's own tick may find it dirty — World settles each wave's caches
+  // serially before its children dispatch, so concurrent readers (the child
+  // wave walking its parent chains) always see it clean.
+  inline auto world_transform() -> const glm::mat4 & {
+    const auto local_version = m_root_component->world_version();
     if (m_parent) {
-      return m_parent->world_transform() * local_transform();
+      // Refresh the parent first so its version reflects this frame.
+      const auto &parent_world = m_parent->world_transform();
+      if (local_version != m_seen_local_version ||
+          m_parent->m_world_version != m_seen_parent_version) {
+        m_world_transform = parent_world * local_transform();
+        m_seen_local_version = local_version;
+        m_seen_parent_version = m_parent->m_world_version;
+        ++m_world_version;
+      }
+    } else if (local_version != m_seen_local_version) {
+      m_world_transform = local_transform();
+      m_seen_local_version = local_version;
+      ++m_world_version;
     }
-
-    return local_transform();
+    return m_world_transform;
   }
   inline auto set_transform(glm::mat4 &transform) -> void {
     m_transform = transform;
+    m_root_component->mark_world_dirty();
   }
 
   inline auto detach_owner() -> void { set_owner(nullptr); }
 
-  inline auto set_owner(Actor *parent) -> void { m_parent = parent; }
-
-  inline auto add_attachment_point(std::string name,
-                                   glm::mat4 &transformation) -> void {
-    m_attachment_points.insert({name, transformation});
+  inline auto set_owner(Actor *parent) -> void {
+    m_parent = parent;
+    // Forces a recompute on the next world_transform() query.
+    m_seen_local_version = ~std::uint32_t(0);
+    m_seen_parent_version = ~std::uint32_t(0);
   }
 
-  inline auto remove_attachment_point(std::string_view name) -> bool {
-    auto iter = m_attachment_points.find(std::string(name));
-    if (iter != m_attachment_points.end()) {
-      m_attachment_points.erase(iter);
-      return true;
+  inline auto owner() -> Actor * { return m_parent; }
+
+  // Adds (or overwrites) an attachment point and returns its interned id.
+  inline auto add_attachment_point(std::string_view name,
+                                   glm::mat4 &transformation) -> AttachmentId {
+    const auto id = attachment_id(name);
+    const auto index = attachment_index(id);
+    if (index != ~std::size_t(0)) {
+      m_attachment_transforms[index] = transformation;
+      return id;
     }
-    return false;
+    m_attachment_ids.push_back(id);
+    m_attachment_transforms.push_back(transformation);
+    return id;
   }
 
-  inline auto attachment_transformation(std::string_view name) -> glm::mat4 & {
-    static auto d = glm::mat4(1.0f);
-    auto iter = m_attachment_points.find(std::string(name));
-    if (iter != m_attachment_points.end()) {
-      return iter->second;
+  inline auto remove_attachment_point(AttachmentId id) -> bool {
+    const auto index = attachment_index(id);
+    if (index == ~std::size_t(0)) {
+      return false;
     }
+    // Swap-remove keeps both parallel arrays dense.
+    m_attachment_ids[index] = m_attachment_ids.back();
+    m_attachment_ids.pop_back();
+    m_attachment_transforms[index] = m_attachment_transforms.back();
+    m_attachment_transforms.pop_back();
+    return true;
+  }
+
+  inline auto remove_attachment_point(std::string_view name) -> bool {
+    return remove_attachment_point(attachment_id(name));
+  }
+
+  // Per-frame socket query: scans this actor's few interned ids and reads the
+  // matrix from contiguous storage — no allocation, no hashing. Unknown
+  // sockets read as identity.
+  inline auto attachment_transformation(AttachmentId id) const
+      -> const glm::mat4 & {
+    static const auto identity = glm::mat4(1.0f);
+    const auto index = attachment_index(id);
+    return index != ~std::size_t(0) ? m_attachment_transforms[index] : identity;
+  }
+
+  // Name-based convenience; hot paths should resolve the id once instead.
+  inline auto attachment_transformation(std::string_view name) const
+      -> const glm::mat4 & {
+    return attachment_transformation(attachment_id(name));
+  }
 
-    return d;
+  inline auto set_attachment_transformation(AttachmentId id,
+                                            const glm::mat4 &transformation)
+      -> bool {
+    const auto index = attachment_index(id);
+    if (index == ~std::size_t(0)) {
+      return false;
+    }
+    m_attachment_transforms[index] = transformation;
+    return true;
   }
 
-  inline auto root_component() -> ActorComponent * { return m_root_component.get(); }
+  inline auto root_component() -> ActorComponent * { return m_root_component; }
+
+  // Index into the owning World's ActorStore. Managed by World.
+  inline auto store_index() const -> std::size_t { return m_store_index; }
+
+  // Actors with no per-frame behavior beyond the bulk array passes can opt
+  // out of the virtual update dispatch in World::update.
+  inline auto set_scripted(bool scripted) -> void { m_scripted = scripted; }
+  inline auto scripted() const -> bool { return m_scripted; }
+
+  // Which tick bucket World schedules this actor into. Set directly or via
+  // the world's tick-rate hook; actors migrate between tiers freely.
+  inline auto set_tick_rate(TickRate rate) -> void { m_tick_rate = rate; }
+  inline auto tick_rate() const -> TickRate { return m_tick_rate; }
+
+  // The world region (cell) this actor belongs to. Assigned through
+  // World::set_region; managed by World.
+  inline auto region() const -> std::uint32_t { return m_region; }
 
 protected:
-  std::shared_ptr<ActorComponent> m_root_component = nullptr;
+  friend class World;
+
+  inline auto attachment_index(AttachmentId id) const -> std::size_t {
+    for (std::size_t i = 0; i < m_attachment_ids.size(); ++i) {
+      if (m_attachment_ids[i] == id) {
+        return i;
+      }
+    }
+    return ~std::size_t(0);
+  }
+
+  // Arena-owned, released in the destructor.
+  ActorComponent *m_root_component = nullptr;
   Actor *m_parent = nullptr;
-  std::unordered_map<std::string, glm::mat4> m_attachment_points;
+  // Parallel arrays: ids and transforms share an index.
+  std::vector<AttachmentId> m_attachment_ids;
+  std::vector<glm::mat4> m_attachment_transforms;
   glm::mat4 m_transform = {};
+  glm::mat4 m_world_transform = glm::mat4(1.0);
+  std::size_t m_store_index = ~std::size_t(0);
+  // Region id and index into that region's dense actor array. Managed by
+  // World.
+  std::uint32_t m_region = 0;
+  std::size_t m_region_index = ~std::size_t(0);
+  // Version pulled by child actors; the seen counters record what this cache
+  // was built from.
+  std::uint32_t m_world_version = 0;
+  std::uint32_t m_seen_local_version = ~std::uint32_t(0);
+  std::uint32_t m_seen_parent_version = ~std::uint32_t(0);
+  bool m_scripted = true;
+  TickRate m_tick_rate = TickRate::EveryFrame;
+  // World time of this actor's last scripted tick; negative until the first
+  // tick. Managed by World, which diffs it against the current world time so
+  // dt stays right across tick-tier migration.
+  double m_last_tick_time = -1.0;
 };
 }
@@ -1,13 +1,33 @@
 #pragma once
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <glm/glm.hpp>
 #include <memory>
+#include <meshi/bits/util/arena.hpp>
+#include <meshi/bits/util/slice.hpp>
 #include <string>
 #include <string_view>
 #include <vector>
 namespace meshi {
 class Component;
 
+namespace detail {
+// Monotonically increasing index handed out the first time a type is queried.
+// Used to index the per-type subobject buckets inside Object. Atomic: two
+// worker threads can race to initialize the magic statics of two different
+// types, and a plain increment could hand both the same index.
+inline auto next_object_type_index() -> std::size_t {
+  static std::atomic<std::size_t> counter{0};
+  return counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename T> inline auto object_type_index() -> std::size_t {
+  static const std::size_t index = next_object_type_index();
+  return index;
+}
+} // namespace detail
+
 // Basis of all Objects.
 // Can contain sub-objects.
 // Can be activated/deactivated.
@@ -18,7 +38,13 @@ public:
   //////////////////////////////////////////////////////
 
   Object() {}
-  virtual ~Object() = default;
+  virtual ~Object() {
+    // Subobjects live in the arena; tear them down through it so their slots
+    // recycle (or short-circuit if an arena reset got there first).
+    for (auto *sub : m_subobjects) {
+      detail::object_arena().destroy(sub);
+    }
+  }
   virtual auto on_activation() -> void {};
   virtual auto on_deactivation() -> void {};
 
@@ -40,32 +66,50 @@ public:
   }
 
   template <typename T> auto add_subobject() -> T * {
-    auto s = std::make_shared<T>();
+    auto *s = detail::object_arena().create<T>();
     m_subobjects.push_back(s);
-    return s.get();
+    register_subobject(s);
+    return s;
   }
 
   template <typename T> auto add_subobject(typename T::CreateInfo info) -> T * {
-    auto s = std::make_shared<T>(info);
+    auto *s = detail::object_arena().create<T>(info);
     m_subobjects.push_back(s);
-    return s.get();
+    register_subobject(s);
+    return s;
   }
 
   template <typename T> inline auto is_type() -> bool {
     return dynamic_cast<T *>(this) != nullptr;
   }
 
-  // Provides filtered vector of all subobjects of that type
-  template <typename T> auto subobjects() -> std::vector<T *> {
-    auto o = std::vector<T *>();
-
-    std::for_each(m_subobjects.begin(), m_subobjects.end(), [&o](auto i) {
-      if (auto ptr = std::dynamic_pointer_cast<T>(i)) {
-        o.push_back(ptr.get());
+  // Removes a subobject added via add_subobject, dropping it from every
+  // type bucket it was registered in and returning its slot to the arena.
+  auto remove_subobject(Object *object) -> void {
+    for (auto &b : m_type_buckets) {
+      if (b.matches && b.matches(object)) {
+        b.members.erase(std::remove(b.members.begin(), b.members.end(), object),
+                        b.members.end());
       }
-    });
+    }
+    const auto before = m_subobjects.size();
+    m_subobjects.erase(
+        std::remove(m_subobjects.begin(), m_subobjects.end(), object),
+        m_subobjects.end());
+    if (m_subobjects.size() != before) {
+      detail::object_arena().destroy(object);
+    }
+  }
 
-    return o;
+  // Provides all subobjects of that type as a view over the per-type bucket.
+  // The RTTI cost is paid once per type when a subobject is added, not per
+  // query, and no vector is allocated per call.
+  template <typename T> auto subobjects() -> Slice<T *> {
+    auto &b = bucket<T>();
+    // Safe because the hierarchy is single-inheritance from Object, so the
+    // stored Object* and the derived T* share an address.
+    return Slice<T *>(reinterpret_cast<T **>(b.members.data()),
+                      b.members.size());
   }
 
   // Provides filtered vector of all subobjects of that type with an optional
@@ -73,28 +117,60 @@ public:
   template <typename T, typename Predicate>
   auto filter_subobjects(std::vector<T *> *out, Predicate predicate) -> void {
     out->clear();
-    std::for_each(m_subobjects.begin(), m_subobjects.end(),
-                  [out, &predicate](auto i) {
-                    if (auto ptr = std::dynamic_pointer_cast<T>(i)) {
-                      if (predicate(ptr.get())) { // Apply the custom predicate
-                        out->push_back(ptr.get());
-                      }
-                    }
-                  });
+    for (auto *member : bucket<T>().members) {
+      auto *ptr = static_cast<T *>(member);
+      if (predicate(ptr)) { // Apply the custom predicate
+        out->push_back(ptr);
+      }
+    }
   }
 
   // Provides filtered vector of all subobjects of that type
   template <typename T> auto filter_subobjects(std::vector<T *> *out) -> void {
     out->clear();
-    std::for_each(m_subobjects.begin(), m_subobjects.end(), [out](auto i) {
-      if (auto ptr = std::dynamic_pointer_cast<T>(i)) {
-        out->push_back(ptr.get());
-      }
-    });
+    for (auto *member : bucket<T>().members) {
+      out->push_back(static_cast<T *>(member));
+    }
   }
 
 protected:
-  std::vector<std::shared_ptr<Object>> m_subobjects;
+  // Per-type bucket of subobjects, kept current as subobjects are added so
+  // typed queries are an O(1) lookup returning a span.
+  struct TypeBucket {
+    bool (*matches)(Object *) = nullptr;
+    std::vector<Object *> members;
+  };
+
+  template <typename T> auto bucket() -> TypeBucket & {
+    const auto index = detail::object_type_index<T>();
+    if (m_type_buckets.size() <= index) {
+      m_type_buckets.resize(index + 1);
+    }
+    auto &b = m_type_buckets[index];
+    if (!b.matches) {
+      b.matches = [](Object *object) -> bool {
+        return dynamic_cast<T *>(object) != nullptr;
+      };
+      for (auto *sub : m_subobjects) {
+        if (b.matches(sub)) {
+          b.members.push_back(sub);
+        }
+      }
+    }
+    return b;
+  }
+
+  auto register_subobject(Object *object) -> void {
+    for (auto &b : m_type_buckets) {
+      if (b.matches && b.matches(object)) {
+        b.members.push_back(object);
+      }
+    }
+  }
+
+  // Arena-owned; destroyed through ObjectArena, never delete.
+  std::vector<Object *> m_subobjects;
+  std::vector<TypeBucket> m_type_buckets;
   bool m_active = false;
 };
 } // namespace meshi
@@ -3,6 +3,7 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <meshi/bits/objects/actor.hpp>
+#include <meshi/bits/util/slice.hpp>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -29,8 +30,8 @@ public:
     // Update position using velocity
     m_transform = glm::translate(m_transform, m_velocity * dt);
 
-    // Check collisions and resolve them
-    resolve_collisions();
+    // Collisions are resolved by World's broadphase pass after every denizen
+    // has moved.
   }
   
   virtual auto update(float dt) -> void override {
@@ -78,6 +79,35 @@ public:
     return false;
   }
 
+  // Union AABB over this denizen's colliders, used to place it in the
+  // broadphase. Returns false when it has no colliders.
+  inline auto bounds(glm::vec3 *out_min, glm::vec3 *out_max) -> bool {
+    if (m_colliders.empty()) {
+      return false;
+    }
+    auto min = m_colliders.front().min;
+    auto max = m_colliders.front().max;
+    for (const auto &collider : m_colliders) {
+      min = glm::min(min, collider.min);
+      max = glm::max(max, collider.max);
+    }
+    *out_min = min;
+    *out_max = max;
+    return true;
+  }
+
+  // Resolves collisions against the candidates the broadphase found nearby.
+  // Called by World once per frame after movement; for simplicity a hit stops
+  // the Denizen.
+  inline auto resolve_collisions(Slice<Denizen *> candidates) -> void {
+    for (auto *other : candidates) {
+      if (is_colliding_with(*other)) {
+        m_velocity = glm::vec3(0.0f); // Stop movement
+        return;
+      }
+    }
+  }
+
 private:
   struct Collider {
     glm::vec3 min;
@@ -88,47 +118,11 @@ private:
   float m_dampening_factor = 0.1f; // Default dampening factor
   std::vector<Collider> m_colliders;
 
-  // Resolve collisions (simplified example)
-  auto resolve_collisions() -> void {
-    // For simplicity, this example assumes collisions are resolved by stopping
-    // the Denizen.
-    for (const auto &collider : m_colliders) {
-      for (const auto &other : m_potential_collisions) {
-        for (const auto &other_collider : other->m_colliders) {
-          if (check_collision(collider, other_collider)) {
-            m_velocity = glm::vec3(0.0f); // Stop movement
-            return;
-          }
-        }
-      }
-    }
-  }
-
   // Basic AABB collision check
   static auto check_collision(const Collider &a, const Collider &b) -> bool {
     return (a.min.x <= b.max.x && a.max.x >= b.min.x) &&
            (a.min.y <= b.max.y && a.max.y >= b.min.y) &&
            (a.min.z <= b.max.z && a.max.z >= b.min.z);
   }
-
-  // List of other Denizens to check collisions with
-  std::vector<Denizen *> m_potential_collisions;
-
-public:
-  // Add a potential collision target
-  inline auto add_potential_collision(Denizen *other) -> void {
-    if (std::find(m_potential_collisions.begin(), m_potential_collisions.end(),
-                  other) == m_potential_collisions.end()) {
-      m_potential_collisions.push_back(other);
-    }
-  }
-
-  // Remove a potential collision target
-  inline auto remove_potential_collision(Denizen *other) -> void {
-    m_potential_collisions.erase(std::remove(m_potential_collisions.begin(),
-                                             m_potential_collisions.end(),
-                                             other),
-                                 m_potential_collisions.end());
-  }
 };
 } // namespace meshi
@@ -0,0 +1,206 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+namespace meshi {
+
+namespace detail {
+// Monotonic per-type index for arena slab lookup, same scheme as the Object
+// subobject buckets. Atomic for the same reason: magic-static initialization
+// of two different types can race from worker threads.
+inline auto next_arena_type_index() -> std::size_t {
+  static std::atomic<std::size_t> counter{0};
+  return counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename T> inline auto arena_type_index() -> std::size_t {
+  static const std::size_t index = next_arena_type_index();
+  return index;
+}
+} // namespace detail
+
+// Slab arena for the Object/Component graph. Each type gets its own slabs so
+// same-type objects sit contiguously, and bulk teardown is a reset over the
+// slabs instead of one heap free per object. Individual destruction recycles
+// the slot onto a per-type free list.
+//
+// create/destroy are safe to call from worker threads: parallel actor ticks
+// may spawn or remove subobjects, and the per-type slab vectors and free
+// lists are shared state, so both paths serialize on one arena lock.
+// Allocation is not a per-frame hot path, so the lock stays uncontended in
+// steady state.
+class ObjectArena {
+public:
+  ObjectArena() = default;
+  ObjectArena(const ObjectArena &) = delete;
+  auto operator=(const ObjectArena &) -> ObjectArena & = delete;
+  ~ObjectArena() { reset(); }
+
+  // Constructs a T inside its type's slab. The returned pointer is stable for
+  // the object's lifetime and must be released with destroy() or reset().
+  template <typename T, typename... Args> auto create(Args &&...args) -> T * {
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "arena slots are max_align_t aligned");
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    auto &slabs = type_slabs<T>();
+    auto *header = slabs.allocate(*this);
+    header->owner = &slabs;
+    header->live = 1;
+    void *storage = reinterpret_cast<std::byte *>(header) + HEADER_SIZE;
+    T *object = new (storage) T(std::forward<Args>(args)...);
+    ++m_object_count;
+    return object;
+  }
+
+  // Runs the object's destructor and recycles its slot. Destroying an
+  // already-destroyed slot is a no-op, which lets parents tear down children
+  // that a full reset may also visit.
+  auto destroy(void *object) -> void {
+    if (object == nullptr) {
+      return;
+    }
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    auto *header = reinterpret_cast<SlotHeader *>(
+        static_cast<std::byte *>(object) - HEADER_SIZE);
+    if (!header->live) {
+      return;
+    }
+    header->live = 0;
+    header->owner->destroy_fn(object);
+    header->owner->free_slots.push_back(header);
+    --m_object_count;
+  }
+
+  // Destroys every remaining live object and drops all slabs. Destructors
+  // run for all types before any storage is released, since tearing down one
+  // object may destroy() children living in another type's slabs.
+  auto reset() -> void {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    for (auto &slabs : m_types) {
+      if (slabs) {
+        slabs->reset();
+      }
+    }
+    for (auto &slabs : m_types) {
+      if (slabs) {
+        slabs->slabs.clear();
+        slabs->free_slots.clear();
+      }
+    }
+    m_object_count = 0;
+    m_bytes_reserved = 0;
+  }
+
+  // Live objects across every type. Feeds the engine's memory accounting.
+  [[nodiscard]] auto object_count() const -> std::size_t {
+    return m_object_count;
+  }
+
+  // Total slab bytes currently reserved, live or free.
+  [[nodiscard]] auto bytes_reserved() const -> std::size_t {
+    return m_bytes_reserved;
+  }
+
+private:
+  struct TypeSlabs;
+
+  // Precedes every object in its slot; locates the owning type's slabs and
+  // guards against double destruction.
+  struct SlotHeader {
+    TypeSlabs *owner;
+    std::uint8_t live;
+  };
+
+  // Headers are padded to keep every object max_align_t aligned.
+  static constexpr std::size_t HEADER_SIZE =
+      (sizeof(SlotHeader) + alignof(std::max_align_t) - 1) /
+      alignof(std::max_align_t) * alignof(std::max_align_t);
+
+  struct Slab {
+    std::unique_ptr<std::byte[]> storage;
+    std::size_t used = 0;
+  };
+
+  struct TypeSlabs {
+    std::size_t slot_size = 0;
+    std::size_t slots_per_slab = 0;
+    void (*destroy_fn)(void *) = nullptr;
+    std::vector<Slab> slabs;
+    std::vector<SlotHeader *> free_slots;
+
+    auto allocate(ObjectArena &arena) -> SlotHeader * {
+      if (!free_slots.empty()) {
+        auto *slot = free_slots.back();
+        free_slots.pop_back();
+        return slot;
+      }
+      if (slabs.empty() || slabs.back().used == slots_per_slab) {
+        slabs.push_back(
+            Slab{std::make_unique<std::byte[]>(slot_size * slots_per_slab), 0});
+        arena.m_bytes_reserved += slot_size * slots_per_slab;
+      }
+      auto &slab = slabs.back();
+      return reinterpret_cast<SlotHeader *>(slab.storage.get() +
+                                            slot_size * slab.used++);
+    }
+
+    auto reset() -> void {
+      for (auto &slab : slabs) {
+        for (std::size_t i = 0; i < slab.used; ++i) {
+          auto *header = reinterpret_cast<SlotHeader *>(slab.storage.get() +
+                                                        slot_size * i);
+          if (header->live) {
+            header->live = 0;
+            destroy_fn(reinterpret_cast<std::byte *>(header) + HEADER_SIZE);
+          }
+        }
+      }
+    }
+  };
+
+  template <typename T> auto type_slabs() -> TypeSlabs & {
+    static constexpr std::size_t SLAB_OBJECTS = 256;
+    const auto index = detail::arena_type_index<T>();
+    if (m_types.size() <= index) {
+      m_types.resize(index + 1);
+    }
+    if (!m_types[index]) {
+      auto slabs = std::make_unique<TypeSlabs>();
+      slabs->slot_size =
+          HEADER_SIZE + (sizeof(T) + alignof(std::max_align_t) - 1) /
+                            alignof(std::max_align_t) * alignof(std::max_align_t);
+      slabs->slots_per_slab = SLAB_OBJECTS;
+      slabs->destroy_fn = [](void *object) { static_cast<T *>(object)->~T(); };
+      m_types[index] = std::move(slabs);
+    }
+    return *m_types[index];
+  }
+
+  // unique_ptr entries keep TypeSlabs addresses stable across resizes, since
+  // every slot header points back at its owner.
+  std::vector<std::unique_ptr<TypeSlabs>> m_types;
+  // Recursive: an object's constructor and destructor re-enter the arena to
+  // create or destroy its own subobjects (e.g. Actor's root component), and
+  // reset() runs destructors that destroy() their children.
+  std::recursive_mutex m_mutex;
+  // Atomic so the accounting getters can read them without taking the lock.
+  std::atomic<std::size_t> m_object_count{0};
+  std::atomic<std::size_t> m_bytes_reserved{0};
+};
+
+namespace detail {
+// Process-wide arena backing the Object graph. A free function (rather than
+// an Engine member) so the bits/objects headers can reach it without pulling
+// in engine.hpp.
+inline auto object_arena() -> ObjectArena & {
+  static ObjectArena arena;
+  return arena;
+}
+} // namespace detail
+
+} // namespace meshi
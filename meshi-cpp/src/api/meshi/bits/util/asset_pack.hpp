@@ -0,0 +1,253 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(_WIN32)
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace meshi {
+
+// Compiled binary asset pack: the offline meshi_pack tool flattens an asset
+// directory into one relocatable file, and AssetPack below maps it and
+// resolves names with pointer arithmetic — no parsing, no copies.
+//
+// Layout: PackHeader, then the entry table sorted by name hash, then the
+// name strings, then the data blobs, each aligned so vertex payloads can be
+// handed to the GPU upload path directly.
+namespace pack {
+
+constexpr char MAGIC[8] = {'M', 'E', 'S', 'H', 'I', 'P', 'K', '1'};
+constexpr std::uint32_t VERSION = 1;
+// Blob alignment within the file; generous enough for direct GPU upload.
+constexpr std::uint64_t DATA_ALIGN = 256;
+
+struct PackHeader {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t entry_count;
+  std::uint64_t entry_table_offset;
+  std::uint64_t name_table_offset;
+  std::uint64_t data_offset;
+  std::uint64_t file_size;
+};
+
+struct PackEntry {
+  // FNV-1a of the entry name; the table is sorted by this for binary search.
+  std::uint64_t name_hash;
+  // Offset of the null-terminated name, for hash-collision confirmation.
+  std::uint64_t name_offset;
+  std::uint64_t data_offset;
+  std::uint64_t data_size;
+};
+
+// FNV-1a, the same hash the baker writes into the entry table.
+inline auto hash_name(std::string_view name) -> std::uint64_t {
+  std::uint64_t hash = 14695981039346656037ull;
+  for (auto c : name) {
+    hash ^= static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+} // namespace pack
+
+// Memory-mapped view of a baked asset pack. Opening is one mmap; find() is a
+// binary search over the entry table and returns a pointer straight into the
+// mapping, valid for the pack's lifetime.
+class AssetPack {
+public:
+  struct Blob {
+    const std::byte *data = nullptr;
+    std::size_t size = 0;
+    [[nodiscard]] inline auto valid() const -> bool { return data != nullptr; }
+  };
+
+  AssetPack() = default;
+  AssetPack(const AssetPack &) = delete;
+  auto operator=(const AssetPack &) -> AssetPack & = delete;
+
+  AssetPack(AssetPack &&other) noexcept { *this = std::move(other); }
+
+  auto operator=(AssetPack &&other) noexcept -> AssetPack & {
+    if (this != &other) {
+      close();
+      m_base = other.m_base;
+      m_size = other.m_size;
+#if defined(_WIN32)
+      m_file = other.m_file;
+      m_mapping = other.m_mapping;
+      other.m_file = INVALID_HANDLE_VALUE;
+      other.m_mapping = nullptr;
+#else
+      m_fd = other.m_fd;
+      other.m_fd = -1;
+#endif
+      other.m_base = nullptr;
+      other.m_size = 0;
+    }
+    return *this;
+  }
+
+  ~AssetPack() { close(); }
+
+  // Maps the pack at `path`. Returns an invalid AssetPack (check valid()) if
+  // the file is missing, truncated, or not a pack.
+  static auto open(const char *path) -> AssetPack {
+    AssetPack pack;
+#if defined(_WIN32)
+    pack.m_file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (pack.m_file == INVALID_HANDLE_VALUE) {
+      return pack;
+    }
+    LARGE_INTEGER size{};
+    if (!::GetFileSizeEx(pack.m_file, &size)) {
+      pack.close();
+      return pack;
+    }
+    pack.m_size = static_cast<std::size_t>(size.QuadPart);
+    pack.m_mapping = ::CreateFileMappingA(pack.m_file, nullptr, PAGE_READONLY,
+                                          0, 0, nullptr);
+    if (pack.m_mapping == nullptr) {
+      pack.close();
+      return pack;
+    }
+    pack.m_base = static_cast<const std::byte *>(
+        ::MapViewOfFile(pack.m_mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+    pack.m_fd = ::open(path, O_RDONLY);
+    if (pack.m_fd < 0) {
+      return pack;
+    }
+    struct stat st {};
+    if (::fstat(pack.m_fd, &st) != 0) {
+      pack.close();
+      return pack;
+    }
+    pack.m_size = static_cast<std::size_t>(st.st_size);
+    auto *mapped =
+        ::mmap(nullptr, pack.m_size, PROT_READ, MAP_PRIVATE, pack.m_fd, 0);
+    if (mapped == MAP_FAILED) {
+      pack.close();
+      return pack;
+    }
+    pack.m_base = static_cast<const std::byte *>(mapped);
+#endif
+    if (!pack.validate()) {
+      pack.close();
+    }
+    return pack;
+  }
+
+  [[nodiscard]] inline auto valid() const -> bool { return m_base != nullptr; }
+
+  [[nodiscard]] inline auto entry_count() const -> std::uint32_t {
+    return valid() ? header()->entry_count : 0;
+  }
+
+  // Resolves a name to its blob: one hash, one binary search, zero parsing.
+  // Returns an invalid Blob when the name is not in the pack.
+  [[nodiscard]] auto find(std::string_view name) const -> Blob {
+    if (!valid()) {
+      return {};
+    }
+    const auto hash = pack::hash_name(name);
+    const auto *entries = entry_table();
+    std::size_t lo = 0;
+    std::size_t hi = header()->entry_count;
+    while (lo < hi) {
+      const auto mid = lo + (hi - lo) / 2;
+      if (entries[mid].name_hash < hash) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    // Hash collisions land adjacent; confirm against the stored name.
+    for (; lo < header()->entry_count && entries[lo].name_hash == hash; ++lo) {
+      const auto *stored =
+          reinterpret_cast<const char *>(m_base + entries[lo].name_offset);
+      if (name == stored) {
+        return Blob{m_base + entries[lo].data_offset,
+                    static_cast<std::size_t>(entries[lo].data_size)};
+      }
+    }
+    return {};
+  }
+
+  // Name of the entry at `index`, for enumeration.
+  [[nodiscard]] auto entry_name(std::uint32_t index) const -> const char * {
+    return reinterpret_cast<const char *>(m_base +
+                                          entry_table()[index].name_offset);
+  }
+
+private:
+  [[nodiscard]] auto header() const -> const pack::PackHeader * {
+    return reinterpret_cast<const pack::PackHeader *>(m_base);
+  }
+
+  [[nodiscard]] auto entry_table() const -> const pack::PackEntry * {
+    return reinterpret_cast<const pack::PackEntry *>(
+        m_base + header()->entry_table_offset);
+  }
+
+  [[nodiscard]] auto validate() const -> bool {
+    if (m_base == nullptr || m_size < sizeof(pack::PackHeader)) {
+      return false;
+    }
+    const auto *h = header();
+    return std::memcmp(h->magic, pack::MAGIC, sizeof(pack::MAGIC)) == 0 &&
+           h->version == pack::VERSION && h->file_size == m_size &&
+           h->entry_table_offset + h->entry_count * sizeof(pack::PackEntry) <=
+               m_size;
+  }
+
+  auto close() -> void {
+#if defined(_WIN32)
+    if (m_base != nullptr) {
+      ::UnmapViewOfFile(m_base);
+    }
+    if (m_mapping != nullptr) {
+      ::CloseHandle(m_mapping);
+      m_mapping = nullptr;
+    }
+    if (m_file != INVALID_HANDLE_VALUE) {
+      ::CloseHandle(m_file);
+      m_file = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (m_base != nullptr) {
+      ::munmap(const_cast<std::byte *>(m_base), m_size);
+    }
+    if (m_fd >= 0) {
+      ::close(m_fd);
+      m_fd = -1;
+    }
+#endif
+    m_base = nullptr;
+    m_size = 0;
+  }
+
+  const std::byte *m_base = nullptr;
+  std::size_t m_size = 0;
+#if defined(_WIN32)
+  HANDLE m_file = INVALID_HANDLE_VALUE;
+  HANDLE m_mapping = nullptr;
+#else
+  int m_fd = -1;
+#endif
+};
+
+} // namespace meshi
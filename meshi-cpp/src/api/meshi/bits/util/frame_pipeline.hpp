@@ -0,0 +1,78 @@
+#pragma once
+#include <cassert>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+namespace meshi {
+
+// Single persistent worker for pipelined frame execution: the engine kicks
+// the world tick for frame N onto this thread, submits frame N-1's flushed
+// state to the backend on the main thread, then waits here before swapping
+// buffers. One tick is in flight at most; kick() after kick() without a
+// wait() in between is a bug.
+class FramePipeline {
+public:
+  using Tick = std::function<void(float)>;
+
+  explicit FramePipeline(Tick tick)
+      : m_tick(std::move(tick)), m_thread([this] { loop(); }) {}
+
+  FramePipeline(const FramePipeline &) = delete;
+  auto operator=(const FramePipeline &) -> FramePipeline & = delete;
+
+  ~FramePipeline() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+  }
+
+  // Starts the tick for this frame on the worker. Returns immediately.
+  inline auto kick(float dt) -> void {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    assert(!m_pending && !m_running);
+    m_dt = dt;
+    m_pending = true;
+    m_wake.notify_one();
+  }
+
+  // Blocks until the kicked tick has finished. No-op when nothing is in
+  // flight, so the first frame can wait before its first kick.
+  inline auto wait() -> void {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return !m_pending && !m_running; });
+  }
+
+private:
+  auto loop() -> void {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+      m_wake.wait(lock, [this] { return m_stop || m_pending; });
+      if (m_stop) {
+        return;
+      }
+      m_pending = false;
+      m_running = true;
+      const auto dt = m_dt;
+      lock.unlock();
+      m_tick(dt);
+      lock.lock();
+      m_running = false;
+      m_done.notify_all();
+    }
+  }
+
+  Tick m_tick;
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  std::condition_variable m_done;
+  float m_dt = 0.0f;
+  bool m_pending = false;
+  bool m_running = false;
+  bool m_stop = false;
+  std::thread m_thread;
+};
+} // namespace meshi
@@ -1,10 +1,12 @@
 #pragma once
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstdint>
-#include <cstring>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <vector>
 namespace meshi {
@@ -19,89 +21,263 @@ template <typename T> struct Handle {
   }
 };
 
+// Chunked page storage: slots live in fixed 1024-slot pages reached through a
+// page table (slot >> 10), so growth appends a page instead of reallocating
+// and copying, and a T* handed out for a slot stays valid for the list's
+// lifetime. Iteration within a page is still contiguous. An imported buffer
+// becomes a single non-owning page and never grows, as before.
 template <typename T> class ItemList {
 private:
-  std::unique_ptr<T[]> items;
-  size_t capacity;
-  bool imported;
+  static constexpr size_t PAGE_SHIFT = 10;
+  static constexpr size_t PAGE_SIZE = size_t(1) << PAGE_SHIFT;
 
-public:
-  explicit ItemList(size_t len)
-      : items(std::make_unique<T[]>(len)), capacity(len), imported(false) {}
+  std::vector<std::unique_ptr<T[]>> pages;
+  T *imported_items = nullptr;
+  size_t count = 0;
 
-  ItemList(T *ptr, size_t len) : items(ptr), capacity(len), imported(true) {}
+public:
+  explicit ItemList(size_t len) { expand(len); }
 
-  size_t size() const { return capacity; }
+  ItemList(T *ptr, size_t len) : imported_items(ptr), count(len) {}
 
-  T *data() { return items.get(); }
-  const T *data() const { return items.get(); }
+  size_t size() const { return count; }
 
+  // Appends pages until `amt` more slots exist. No copying, and no pointer to
+  // an existing slot is invalidated; only the page table itself moves.
   void expand(size_t amt) {
-    if (!imported) {
-      size_t new_capacity = capacity + amt;
-      std::unique_ptr<T[]> new_items = std::make_unique<T[]>(new_capacity);
-      std::memcpy(new_items.get(), items.get(), capacity * sizeof(T));
-      items = std::move(new_items);
-      capacity = new_capacity;
+    if (imported_items != nullptr) {
+      return;
+    }
+    count += amt;
+    while (pages.size() << PAGE_SHIFT < count) {
+      pages.push_back(std::make_unique<T[]>(PAGE_SIZE));
     }
   }
 
-  T &operator[](size_t index) { return items[index]; }
-  const T &operator[](size_t index) const { return items[index]; }
+  T &operator[](size_t index) {
+    return imported_items != nullptr
+               ? imported_items[index]
+               : pages[index >> PAGE_SHIFT][index & (PAGE_SIZE - 1)];
+  }
+  const T &operator[](size_t index) const {
+    return imported_items != nullptr
+               ? imported_items[index]
+               : pages[index >> PAGE_SHIFT][index & (PAGE_SIZE - 1)];
+  }
 };
 
+// Concurrent slot map. insert/release run lock-free over an ABA-tagged
+// atomic free list, release bumps the slot generation so stale handles stop
+// validating, and live slots can be walked as packed indices without touching
+// empty ones.
+//
+// Growth is explicit: expand() must run from a single thread before the pool
+// is shared (the generation/live bookkeeping arrays reallocate, which cannot
+// race with the lock-free insert/get_ref/release paths), and insert never
+// grows — a full pool hands back an invalid handle instead. Item storage is
+// paged and never moves, so a T* from get_ref stays valid across growth for
+// the pool's lifetime. Capacity is bounded by the handle's 16-bit slot width.
 template <typename T> class Pool {
+public:
+  // Capacity cap keeping the highest slot index below UINT16_MAX, which
+  // Handle reserves as its invalid sentinel.
+  static constexpr size_t MAX_SLOTS = std::numeric_limits<uint16_t>::max();
+
 private:
+  static constexpr uint32_t NO_SLOT = std::numeric_limits<uint32_t>::max();
+
+  // Per-slot bookkeeping lives in atomic arrays: release() bumps a slot's
+  // generation while get_ref() reads it on another thread, and push_free
+  // writes a slot's free-list link while a concurrent pop_free reads it
+  // inside its CAS loop. Relaxed ordering suffices — the free-list CAS (ABA
+  // tag included) and the live flag's acquire/release already order the
+  // handoffs; the atomics just keep the lock-free paths free of formal
+  // data races.
   ItemList<T> items;
-  std::vector<uint32_t> empty;
-  std::vector<uint16_t> generation;
+  std::unique_ptr<std::atomic<uint16_t>[]> generation;
+  // Per-slot link for the free list; only meaningful while the slot is free.
+  std::unique_ptr<std::atomic<uint32_t>[]> next_free;
+  std::unique_ptr<std::atomic<uint8_t>[]> live;
+  // Packed {tag:32, head slot:32}; the tag advances on every successful pop
+  // or push so a reused slot cannot be mistaken for the old list head.
+  std::atomic<uint64_t> free_head{static_cast<uint64_t>(NO_SLOT)};
+  std::atomic<size_t> live_count{0};
+  std::mutex expand_mutex;
+
+  static uint64_t pack(uint64_t tag, uint32_t slot) {
+    return (tag + 1) << 32 | slot;
+  }
+
+  void push_free(uint32_t slot) {
+    auto head = free_head.load(std::memory_order_acquire);
+    for (;;) {
+      next_free[slot].store(static_cast<uint32_t>(head),
+                            std::memory_order_relaxed);
+      if (free_head.compare_exchange_weak(head, pack(head >> 32, slot),
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_acquire)) {
+        return;
+      }
+    }
+  }
+
+  uint32_t pop_free() {
+    auto head = free_head.load(std::memory_order_acquire);
+    for (;;) {
+      const auto slot = static_cast<uint32_t>(head);
+      if (slot == NO_SLOT) {
+        return NO_SLOT;
+      }
+      if (free_head.compare_exchange_weak(
+              head,
+              pack(head >> 32, next_free[slot].load(std::memory_order_relaxed)),
+              std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return slot;
+      }
+    }
+  }
 
 public:
   explicit Pool(size_t initial_size = 1024)
-      : items(initial_size), generation(initial_size, 0) {
-    for (uint32_t i = 0; i < initial_size; ++i) {
-      empty.push_back(i);
+      : items(std::min(initial_size, MAX_SLOTS)),
+        generation(std::make_unique<std::atomic<uint16_t>[]>(items.size())),
+        next_free(std::make_unique<std::atomic<uint32_t>[]>(items.size())),
+        live(std::make_unique<std::atomic<uint8_t>[]>(items.size())) {
+    for (size_t i = 0; i < items.size(); ++i) {
+      generation[i].store(0, std::memory_order_relaxed);
+      live[i].store(0, std::memory_order_relaxed);
+      push_free(static_cast<uint32_t>(i));
     }
   }
 
+  // Returns an invalid handle when the pool is full. Insert never grows the
+  // pool itself: implicit growth would reallocate the bookkeeping arrays
+  // under concurrent lock-free readers. Size with the constructor or an
+  // up-front expand() instead.
   Handle<T> insert(const T &item) {
-    if (empty.empty()) {
-      expand(1024);
+    const auto slot = pop_free();
+    if (slot == NO_SLOT) {
+      return Handle<T>{};
     }
 
-    uint32_t empty_slot = empty.back();
-    empty.pop_back();
+    items[slot] = item;
+    live[slot].store(1, std::memory_order_release);
+    live_count.fetch_add(1, std::memory_order_relaxed);
 
-    items[empty_slot] = item;
-
-    return Handle<T>{static_cast<uint16_t>(empty_slot), generation[empty_slot]};
+    return Handle<T>{static_cast<uint16_t>(slot),
+                     generation[slot].load(std::memory_order_relaxed)};
   }
 
+  // Adds capacity, clamped to MAX_SLOTS so slot indices always fit the
+  // handle's 16 bits. Single-threaded setup only — the bookkeeping arrays
+  // reallocate, which must not race with the lock-free paths.
   void expand(size_t amount) {
+    std::lock_guard<std::mutex> lock(expand_mutex);
     size_t old_size = items.size();
+    amount = std::min(amount, MAX_SLOTS - old_size);
+    if (amount == 0) {
+      return;
+    }
     items.expand(amount);
-    generation.resize(items.size(), 0);
 
+    auto grown_gen = std::make_unique<std::atomic<uint16_t>[]>(items.size());
+    auto grown_free = std::make_unique<std::atomic<uint32_t>[]>(items.size());
+    auto grown_live = std::make_unique<std::atomic<uint8_t>[]>(items.size());
+    for (size_t i = 0; i < old_size; ++i) {
+      grown_gen[i].store(generation[i].load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+      grown_free[i].store(next_free[i].load(std::memory_order_relaxed),
+                          std::memory_order_relaxed);
+      grown_live[i].store(live[i].load(std::memory_order_relaxed),
+                          std::memory_order_relaxed);
+    }
     for (size_t i = old_size; i < items.size(); ++i) {
-      empty.push_back(static_cast<uint32_t>(i));
+      grown_gen[i].store(0, std::memory_order_relaxed);
+      grown_free[i].store(NO_SLOT, std::memory_order_relaxed);
+      grown_live[i].store(0, std::memory_order_relaxed);
+    }
+    generation = std::move(grown_gen);
+    next_free = std::move(grown_free);
+    live = std::move(grown_live);
+
+    // New slots become visible to concurrent inserts one CAS push at a time.
+    for (size_t i = old_size; i < items.size(); ++i) {
+      push_free(static_cast<uint32_t>(i));
     }
   }
 
   std::optional<T *> get_ref(const Handle<T> &handle) {
-    if (handle.valid() && generation[handle.slot] == handle.generation) {
+    if (handle.valid() && handle.slot < items.size() &&
+        live[handle.slot].load(std::memory_order_acquire) &&
+        generation[handle.slot].load(std::memory_order_relaxed) ==
+            handle.generation) {
       return &items[handle.slot];
     }
     return std::nullopt;
   }
 
-  void release(const Handle<T> &handle) { empty.push_back(handle.slot); }
+  // Invalidates the handle and recycles its slot. The generation bump makes
+  // any outstanding copy of the handle fail get_ref, so use-after-release is
+  // detected instead of silently reading recycled data. Each slot must be
+  // released by one thread at a time (the usual single-owner pattern).
+  void release(const Handle<T> &handle) {
+    if (!handle.valid() || handle.slot >= items.size() ||
+        generation[handle.slot].load(std::memory_order_relaxed) !=
+            handle.generation ||
+        !live[handle.slot].load(std::memory_order_acquire)) {
+      return;
+    }
+    generation[handle.slot].fetch_add(1, std::memory_order_relaxed);
+    live[handle.slot].store(0, std::memory_order_release);
+    live_count.fetch_sub(1, std::memory_order_relaxed);
+    push_free(handle.slot);
+  }
+
+  // Number of live items.
+  size_t size() const { return live_count.load(std::memory_order_relaxed); }
+
+  // Allocated slots, live or free.
+  size_t capacity() const { return items.size(); }
+
+  // Approximate bytes held by the pool's slabs and bookkeeping, for memory
+  // accounting.
+  size_t bytes_reserved() const {
+    return items.size() *
+           (sizeof(T) + sizeof(std::atomic<uint16_t>) +
+            sizeof(std::atomic<uint32_t>) + sizeof(std::atomic<uint8_t>));
+  }
+
+  // Collects the indices of live slots, packed, so hot loops can walk the
+  // occupied items contiguously and repeatedly without rescanning empties.
+  void collect_live(std::vector<uint32_t> *out) {
+    out->clear();
+    for (size_t i = 0; i < items.size(); ++i) {
+      if (live[i].load(std::memory_order_acquire)) {
+        out->push_back(static_cast<uint32_t>(i));
+      }
+    }
+  }
+
+  // Visits every live item. A snapshot under concurrency: items inserted or
+  // released mid-walk may or may not be seen.
+  template <typename Fn> void for_each(Fn fn) {
+    for (size_t i = 0; i < items.size(); ++i) {
+      if (live[i].load(std::memory_order_acquire)) {
+        fn(items[i]);
+      }
+    }
+  }
 
+  // Releases every live slot. Not safe against concurrent access.
   void clear() {
-    empty.clear();
     for (size_t i = 0; i < items.size(); ++i) {
-      empty.push_back(static_cast<uint32_t>(i));
+      if (live[i].load(std::memory_order_relaxed)) {
+        generation[i].fetch_add(1, std::memory_order_relaxed);
+        live[i].store(0, std::memory_order_relaxed);
+        live_count.fetch_sub(1, std::memory_order_relaxed);
+        push_free(static_cast<uint32_t>(i));
+      }
     }
-    std::fill(generation.begin(), generation.end(), 0);
   }
 };
 } // namespace meshi
@@ -0,0 +1,165 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+namespace meshi {
+
+// Engine-owned worker pool with per-worker work-stealing deques. Workers pop
+// from the back of their own deque and steal from the front of the others, so
+// batches submitted together tend to stay warm on one core while idle workers
+// keep the whole pool busy.
+class JobSystem {
+public:
+  using Job = std::function<void()>;
+
+  explicit JobSystem(std::uint32_t worker_count) {
+    if (worker_count == 0) {
+      worker_count = 1;
+    }
+    m_queues.reserve(worker_count);
+    for (std::uint32_t i = 0; i < worker_count; ++i) {
+      m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    m_workers.reserve(worker_count);
+    for (std::uint32_t i = 0; i < worker_count; ++i) {
+      m_workers.emplace_back([this, i] { worker_loop(i); });
+    }
+  }
+
+  JobSystem(const JobSystem &) = delete;
+  auto operator=(const JobSystem &) -> JobSystem & = delete;
+
+  ~JobSystem() {
+    {
+      std::lock_guard<std::mutex> lock(m_wake_mutex);
+      m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto &worker : m_workers) {
+      worker.join();
+    }
+  }
+
+  [[nodiscard]] inline auto worker_count() const -> std::size_t {
+    return m_workers.size();
+  }
+
+  auto submit(Job job) -> void {
+    const auto index =
+        m_next_queue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+    {
+      std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+      m_queues[index]->jobs.push_back(std::move(job));
+    }
+    {
+      std::lock_guard<std::mutex> lock(m_wake_mutex);
+      m_ready += 1;
+    }
+    m_wake.notify_one();
+  }
+
+  // Runs fn(index) for every index in [0, count), partitioned into chunks of
+  // chunk_size spread across the workers. Blocks until every chunk finishes.
+  template <typename Fn>
+  auto parallel_for(std::size_t count, std::size_t chunk_size, Fn &&fn)
+      -> void {
+    if (count == 0) {
+      return;
+    }
+    if (chunk_size == 0) {
+      chunk_size = 1;
+    }
+
+    const auto chunks = (count + chunk_size - 1) / chunk_size;
+    std::atomic<std::size_t> remaining{chunks};
+    std::mutex done_mutex;
+    std::condition_variable done;
+
+    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+      const auto begin = chunk * chunk_size;
+      const auto end = std::min(begin + chunk_size, count);
+      submit([&remaining, &done_mutex, &done, &fn, begin, end] {
+        for (auto i = begin; i < end; ++i) {
+          fn(i);
+        }
+        if (remaining.fetch_sub(1) == 1) {
+          std::lock_guard<std::mutex> lock(done_mutex);
+          done.notify_one();
+        }
+      });
+    }
+
+    std::unique_lock<std::mutex> lock(done_mutex);
+    done.wait(lock, [&remaining] { return remaining.load() == 0; });
+  }
+
+private:
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<Job> jobs;
+  };
+
+  auto worker_loop(std::size_t index) -> void {
+    while (true) {
+      Job job;
+      if (take_job(index, job)) {
+        job();
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(m_wake_mutex);
+      m_wake.wait(lock, [this] { return m_stop || m_ready > 0; });
+      if (m_stop && m_ready == 0) {
+        return;
+      }
+    }
+  }
+
+  auto take_job(std::size_t index, Job &out) -> bool {
+    // Own queue first, from the back.
+    {
+      auto &queue = *m_queues[index];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (!queue.jobs.empty()) {
+        out = std::move(queue.jobs.back());
+        queue.jobs.pop_back();
+        note_taken();
+        return true;
+      }
+    }
+
+    // Steal from the front of the other queues.
+    for (std::size_t offset = 1; offset < m_queues.size(); ++offset) {
+      auto &queue = *m_queues[(index + offset) % m_queues.size()];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (!queue.jobs.empty()) {
+        out = std::move(queue.jobs.front());
+        queue.jobs.pop_front();
+        note_taken();
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  auto note_taken() -> void {
+    std::lock_guard<std::mutex> lock(m_wake_mutex);
+    m_ready -= 1;
+  }
+
+  std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+  std::vector<std::thread> m_workers;
+  std::atomic<std::size_t> m_next_queue{0};
+  std::mutex m_wake_mutex;
+  std::condition_variable m_wake;
+  std::size_t m_ready = 0;
+  bool m_stop = false;
+};
+} // namespace meshi
@@ -0,0 +1,170 @@
+#pragma once
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <meshi/types.hpp>
+#include <queue>
+#include <vector>
+namespace meshi {
+
+// Fire-and-forget latent coroutine. Calling a function that returns Task runs
+// it inline until its first co_await; from then on the engine's TaskScheduler
+// owns the suspension, and the frame destroys itself when the task finishes.
+// Use for "over N seconds / after asset X loads" logic that would otherwise
+// force an actor into the every-frame tick just to decrement a counter.
+struct Task {
+  struct promise_type {
+    auto get_return_object() -> Task { return {}; }
+    auto initial_suspend() noexcept -> std::suspend_never { return {}; }
+    auto final_suspend() noexcept -> std::suspend_never { return {}; }
+    auto return_void() -> void {}
+    auto unhandled_exception() -> void { std::terminate(); }
+  };
+};
+
+// Holds suspended latent tasks and resumes them when due. Sleeping tasks sit
+// in a time-ordered min-heap, so a task waiting ten seconds costs nothing per
+// frame until its wake time; next-frame and asset waits are flat lists walked
+// once per update.
+class TaskScheduler {
+public:
+  // Polls an async load ticket; wired by Engine to
+  // GraphicsSystem::poll_renderable.
+  using AssetPoll = std::function<gfx::AsyncLoadState(
+      Handle<gfx::AsyncRenderable>, Handle<gfx::Renderable> *)>;
+
+  struct WaitSeconds {
+    TaskScheduler *scheduler;
+    double wake;
+
+    auto await_ready() const noexcept -> bool {
+      return wake <= scheduler->m_now;
+    }
+    auto await_suspend(std::coroutine_handle<> handle) -> void {
+      scheduler->m_timed.push(Timed{wake, scheduler->m_sequence++, handle});
+    }
+    auto await_resume() const noexcept -> void {}
+  };
+
+  struct NextFrame {
+    TaskScheduler *scheduler;
+
+    auto await_ready() const noexcept -> bool { return false; }
+    auto await_suspend(std::coroutine_handle<> handle) -> void {
+      scheduler->m_next_frame.push_back(handle);
+    }
+    auto await_resume() const noexcept -> void {}
+  };
+
+  struct AssetReady {
+    TaskScheduler *scheduler;
+    Handle<gfx::AsyncRenderable> ticket{};
+    // Filled by the scheduler's poll before the task resumes; invalid when
+    // the ticket was bad.
+    Handle<gfx::Renderable> result{};
+
+    auto await_ready() -> bool {
+      // Poll once eagerly so an already-resident asset never suspends.
+      if (!scheduler->m_asset_poll) {
+        return true;
+      }
+      return scheduler->m_asset_poll(ticket, &result) !=
+             gfx::AsyncLoadState::Pending;
+    }
+    auto await_suspend(std::coroutine_handle<> handle) -> void {
+      scheduler->m_assets.push_back(AssetWait{ticket, handle, this});
+    }
+    // The live renderable handle, or an invalid handle on a bad ticket.
+    auto await_resume() const noexcept -> Handle<gfx::Renderable> {
+      return result;
+    }
+  };
+
+  // co_await scheduler.wait_seconds(2.f): resumes once at least that much
+  // engine time has elapsed.
+  inline auto wait_seconds(float seconds) -> WaitSeconds {
+    return WaitSeconds{this, m_now + seconds};
+  }
+
+  // co_await scheduler.next_frame(): resumes on the following update.
+  inline auto next_frame() -> NextFrame { return NextFrame{this}; }
+
+  // co_await scheduler.asset_ready(ticket): resumes once the async load
+  // finishes and yields the live renderable handle.
+  inline auto asset_ready(Handle<gfx::AsyncRenderable> ticket) -> AssetReady {
+    return AssetReady{this, ticket};
+  }
+
+  inline auto set_asset_poll(AssetPoll poll) -> void {
+    m_asset_poll = std::move(poll);
+  }
+  [[nodiscard]] inline auto has_asset_poll() const -> bool {
+    return static_cast<bool>(m_asset_poll);
+  }
+
+  // Suspended tasks currently parked in the scheduler.
+  [[nodiscard]] inline auto pending_count() const -> std::size_t {
+    return m_timed.size() + m_next_frame.size() + m_assets.size();
+  }
+
+  // Advances engine time and resumes every due task. Due sets are snapshotted
+  // before resuming, so a task that immediately waits again (even for zero
+  // seconds) runs at most once per update.
+  inline auto update(float dt) -> void {
+    m_now += dt;
+
+    m_resuming.clear();
+    m_resuming.swap(m_next_frame);
+    while (!m_timed.empty() && m_timed.top().wake <= m_now) {
+      m_resuming.push_back(m_timed.top().handle);
+      m_timed.pop();
+    }
+    for (auto handle : m_resuming) {
+      handle.resume();
+    }
+
+    if (!m_assets.empty() && m_asset_poll) {
+      m_pending_assets.clear();
+      m_pending_assets.swap(m_assets);
+      for (auto &wait : m_pending_assets) {
+        if (m_asset_poll(wait.ticket, &wait.awaiter->result) ==
+            gfx::AsyncLoadState::Pending) {
+          m_assets.push_back(wait);
+        } else {
+          wait.handle.resume();
+        }
+      }
+    }
+  }
+
+private:
+  struct Timed {
+    double wake;
+    // Tie-break so equal wake times resume in the order they suspended.
+    std::uint64_t sequence;
+    std::coroutine_handle<> handle;
+
+    auto operator>(const Timed &other) const -> bool {
+      return wake != other.wake ? wake > other.wake
+                                : sequence > other.sequence;
+    }
+  };
+
+  struct AssetWait {
+    Handle<gfx::AsyncRenderable> ticket;
+    std::coroutine_handle<> handle;
+    AssetReady *awaiter;
+  };
+
+  std::priority_queue<Timed, std::vector<Timed>, std::greater<Timed>> m_timed;
+  std::vector<std::coroutine_handle<>> m_next_frame;
+  std::vector<AssetWait> m_assets;
+  // Scratch for the per-update snapshots.
+  std::vector<std::coroutine_handle<>> m_resuming;
+  std::vector<AssetWait> m_pending_assets;
+  AssetPoll m_asset_poll;
+  double m_now = 0.0;
+  std::uint64_t m_sequence = 0;
+};
+} // namespace meshi
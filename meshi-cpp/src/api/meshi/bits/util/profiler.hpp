@@ -0,0 +1,108 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <meshi_types.h>
+#include <vector>
+namespace meshi {
+
+// One frame's timing record: the C++ phases measured around the engine loop
+// plus the plugin's internal per-system numbers. All values in milliseconds.
+struct FrameStats {
+  float backend_ms = 0.0f;          // full plugin update crossing
+  float event_ms = 0.0f;            // event/action dispatch inside it
+  float physics_readback_ms = 0.0f; // batched rigid-body status refresh
+  float cull_ms = 0.0f;             // frustum cull over registered bounds
+  float world_ms = 0.0f;            // World::update
+  float transform_flush_ms = 0.0f;  // queued transform submit
+  // Plugin-side systems, reported via get_frame_timings.
+  float plugin_physics_ms = 0.0f;
+  float plugin_render_ms = 0.0f;
+  float plugin_audio_ms = 0.0f;
+  float plugin_total_ms = 0.0f;
+  float total_ms = 0.0f;
+};
+
+// Lightweight frame profiler. Scope timers accumulate into the in-flight
+// frame and end_frame() pushes it into a fixed ring of the last 300 frames,
+// so recent history can be dumped whenever a hitch is detected.
+class FrameProfiler {
+public:
+  static constexpr std::size_t HISTORY = 300;
+
+  // RAII scope timer; adds the elapsed time to the given accumulator.
+  class Scope {
+  public:
+    explicit Scope(float &accum)
+        : m_accum(&accum), m_begin(std::chrono::steady_clock::now()) {}
+    ~Scope() {
+      *m_accum += std::chrono::duration<float, std::milli>(
+                      std::chrono::steady_clock::now() - m_begin)
+                      .count();
+    }
+    Scope(const Scope &) = delete;
+    auto operator=(const Scope &) -> Scope & = delete;
+
+  private:
+    float *m_accum;
+    std::chrono::steady_clock::time_point m_begin;
+  };
+
+  inline auto begin_frame() -> void {
+    m_current = FrameStats{};
+    m_frame_begin = std::chrono::steady_clock::now();
+  }
+
+  // Accumulators for the frame currently being measured.
+  inline auto current() -> FrameStats & { return m_current; }
+
+  [[nodiscard]] inline auto time(float &accum) -> Scope { return Scope(accum); }
+
+  // Folds in the plugin's numbers and commits the frame to the ring.
+  inline auto end_frame(const MeshiFrameTimings &plugin) -> void {
+    m_current.plugin_physics_ms = plugin.physics_ms;
+    m_current.plugin_render_ms = plugin.render_ms;
+    m_current.plugin_audio_ms = plugin.audio_ms;
+    m_current.plugin_total_ms = plugin.total_ms;
+    m_current.total_ms = std::chrono::duration<float, std::milli>(
+                             std::chrono::steady_clock::now() - m_frame_begin)
+                             .count();
+    m_history[m_next] = m_current;
+    m_next = (m_next + 1) % HISTORY;
+    if (m_count < HISTORY) {
+      ++m_count;
+    }
+  }
+
+  // Most recent completed frame.
+  [[nodiscard]] inline auto last() const -> const FrameStats & {
+    return m_history[(m_next + HISTORY - 1) % HISTORY];
+  }
+
+  // Copies the recorded frames into `out`, oldest first.
+  inline auto history(std::vector<FrameStats> *out) const -> void {
+    out->clear();
+    out->reserve(m_count);
+    for (std::size_t i = 0; i < m_count; ++i) {
+      out->push_back(m_history[(m_next + HISTORY - m_count + i) % HISTORY]);
+    }
+  }
+
+private:
+  FrameStats m_current{};
+  std::chrono::steady_clock::time_point m_frame_begin{};
+  std::array<FrameStats, HISTORY> m_history{};
+  std::size_t m_next = 0;
+  std::size_t m_count = 0;
+};
+
+namespace detail {
+// Process-wide profiler, reachable from the event/action handlers without
+// pulling in engine.hpp.
+inline auto frame_profiler() -> FrameProfiler & {
+  static FrameProfiler profiler;
+  return profiler;
+}
+} // namespace detail
+
+} // namespace meshi
@@ -7,6 +7,9 @@
 #include <meshi/bits/action.hpp>
 #include <meshi/bits/error.hpp>
 #include <meshi/bits/event.hpp>
+#include <meshi/bits/util/frame_pipeline.hpp>
+#include <meshi/bits/util/latent_task.hpp>
+#include <meshi/bits/util/profiler.hpp>
 #include <string>
 #include <string_view>
 #include <meshi.h>
@@ -15,6 +18,20 @@ namespace meshi {
 struct EngineInfo {
   std::string application_name = std::string("MESHI APPLICATION");
   std::string application_root = std::string("");
+  // Number of worker threads for the parallel World::update path. Zero keeps
+  // the actor tick single-threaded.
+  std::uint32_t worker_threads = 0;
+  // Run without a window or swapchain, e.g. for server-side simulation or CI
+  // performance tests.
+  bool headless = false;
+  // Pipelined frame execution: World::update for frame N runs on a persistent
+  // worker thread while the backend submits frame N-1's flushed state.
+  // Forces polled event delivery — the frame's event batch is dispatched on
+  // the main thread after the world sync, so gameplay code never runs
+  // concurrently with itself. Actor code must stay on the queued transform
+  // and audio paths; immediate backend calls from Actor::update are not
+  // synchronized against render submission in this mode.
+  bool pipelined = false;
 };
 class Engine {
 public:
@@ -22,11 +39,11 @@ public:
     const auto backend_info = EngineBackendInfo{
         .application_name = info.application_name.c_str(),
         .application_location = info.application_root.c_str(),
-        .headless = 0,
+        .headless = info.headless ? 1 : 0,
     };
 
     return make_result<Engine, Error>(
-        Engine(backend_info));
+        Engine(backend_info, info.worker_threads, info.pipelined));
   };
 
   inline auto world() -> World & { return m_world; }
@@ -35,25 +52,182 @@ public:
   }
 
   inline auto update() -> void {
-    m_dt = m_backend.update();
-    m_world.update(m_dt);
+    if (!m_tasks.has_asset_poll()) {
+      // Wired on first use for the same reason the pipeline is: the lambda
+      // binds this engine's final address.
+      m_tasks.set_asset_poll(
+          [this](Handle<gfx::AsyncRenderable> ticket,
+                 Handle<gfx::Renderable> *out) {
+            return m_backend.graphics().poll_renderable(ticket, out);
+          });
+    }
+    if (m_pipelined) {
+      if (!m_pipeline) {
+        // Created on first use, not in the constructor: the worker's callback
+        // binds this engine's address, and Engine is moved through Result
+        // during make().
+        m_pipeline = std::make_unique<FramePipeline>(
+            [this](float dt) { m_world.update(dt, m_jobs.get()); });
+      }
+      update_pipelined();
+      return;
+    }
+    auto &profiler = detail::frame_profiler();
+    profiler.begin_frame();
+    {
+      auto timer = profiler.time(profiler.current().backend_ms);
+      m_dt = m_backend.update();
+    }
+    {
+      auto timer = profiler.time(profiler.current().physics_readback_ms);
+      m_backend.physics().update_tracked_statuses();
+    }
+    {
+      auto timer = profiler.time(profiler.current().cull_ms);
+      m_backend.graphics().run_cull_pass();
+    }
+    {
+      auto timer = profiler.time(profiler.current().world_ms);
+      m_world.update(m_dt, m_jobs.get());
+      m_tasks.update(m_dt);
+    }
+    {
+      auto timer = profiler.time(profiler.current().transform_flush_ms);
+      m_backend.graphics().flush_queued_transforms();
+      m_backend.audio().flush_queued_updates();
+    }
+    MeshiFrameTimings plugin{};
+    m_backend.get_frame_timings(&plugin);
+    profiler.end_frame(plugin);
+  }
+
+  // One frame of the pipelined schedule. The world tick for frame N overlaps
+  // m_backend.update(), which submits frame N-1's flushed state and pumps the
+  // window; the sync before the queue flush is the buffer swap. The tick uses
+  // last frame's dt — the elapsed time for this frame isn't known until the
+  // backend pump returns, and by then the tick is already in flight.
+  inline auto update_pipelined() -> void {
+    auto &profiler = detail::frame_profiler();
+    profiler.begin_frame();
+    {
+      auto timer = profiler.time(profiler.current().physics_readback_ms);
+      m_backend.physics().update_tracked_statuses();
+    }
+    {
+      auto timer = profiler.time(profiler.current().cull_ms);
+      m_backend.graphics().run_cull_pass();
+    }
+    m_pipeline->kick(m_dt);
+    float next_dt = 0.0f;
+    {
+      auto timer = profiler.time(profiler.current().backend_ms);
+      next_dt = m_backend.update();
+    }
+    {
+      // Only the part of the tick the backend pump did not hide, plus the
+      // latent tasks — those run here on the main thread, with the same dt
+      // the world ticked with, so they see a consistent frame.
+      auto timer = profiler.time(profiler.current().world_ms);
+      m_pipeline->wait();
+      m_tasks.update(m_dt);
+    }
+    m_dt = next_dt;
+    {
+      auto timer = profiler.time(profiler.current().transform_flush_ms);
+      m_backend.graphics().flush_queued_transforms();
+      m_backend.audio().flush_queued_updates();
+    }
+    // Deliver the frame's polled event batch now that the world is idle.
+    for (auto &event : m_event->poll_events()) {
+      m_event->dispatch(event);
+    }
+    MeshiFrameTimings plugin{};
+    m_backend.get_frame_timings(&plugin);
+    profiler.end_frame(plugin);
   }
 
   inline auto event() -> EventHandler & { return *m_event; }
   inline auto action() -> ActionHandler & { return *m_action; }
+  inline auto tasks() -> TaskScheduler & { return m_tasks; }
+
+  // Latent-task awaitables, resumed by the scheduler once due. A sleeping
+  // task costs nothing per frame, so "do X in two seconds" logic no longer
+  // needs an every-frame actor tick:
+  //   co_await meshi::engine()->wait_seconds(2.f);
+  inline auto wait_seconds(float seconds) -> TaskScheduler::WaitSeconds {
+    return m_tasks.wait_seconds(seconds);
+  }
+  inline auto next_frame() -> TaskScheduler::NextFrame {
+    return m_tasks.next_frame();
+  }
+  inline auto asset_ready(Handle<gfx::AsyncRenderable> ticket)
+      -> TaskScheduler::AssetReady {
+    return m_tasks.asset_ready(ticket);
+  }
   inline auto backend() -> EngineBackend & { return m_backend; }
+  inline auto jobs() -> JobSystem * { return m_jobs.get(); }
+
+  // Point-in-time memory accounting for long-session leak triage: the
+  // arena-backed Object graph and handler tables on this side of the
+  // boundary, plus the plugin's per-system resource counts.
+  struct MemoryStats {
+    std::size_t object_count = 0;         // live arena objects/components
+    std::size_t arena_bytes_reserved = 0; // slab bytes, live or free
+    std::size_t event_callbacks = 0;      // EventHandler table entries
+    std::size_t action_types = 0;         // interned action names
+    std::size_t action_callbacks = 0;     // ActionHandler bucket entries
+    MeshiMemoryStats plugin{};            // graphics/physics/audio counts
+  };
+
+  inline auto memory_stats() -> MemoryStats {
+    MemoryStats stats{};
+    auto &arena = detail::object_arena();
+    stats.object_count = arena.object_count();
+    stats.arena_bytes_reserved = arena.bytes_reserved();
+    stats.event_callbacks = m_event->callback_count();
+    stats.action_types = m_action->action_type_count();
+    stats.action_callbacks = m_action->callback_count();
+    m_backend.get_memory_stats(&stats.plugin);
+    return stats;
+  }
+
+  // Timing of the most recent frame: C++ phases plus plugin systems.
+  inline auto frame_stats() -> const FrameStats & {
+    return detail::frame_profiler().last();
+  }
+
+  // Copies the last 300 frames into `out`, oldest first.
+  inline auto frame_history(std::vector<FrameStats> *out) -> void {
+    detail::frame_profiler().history(out);
+  }
 
 private:
-  Engine(const EngineBackendInfo &info)
+  Engine(const EngineBackendInfo &info, std::uint32_t worker_threads,
+         bool pipelined = false)
       : m_backend(info),
         m_event(std::make_shared<EventHandler>(&m_backend)),
-        m_action(std::make_shared<ActionHandler>(*m_event)){};
+        m_action(std::make_shared<ActionHandler>(*m_event)) {
+    if (worker_threads > 0) {
+      m_jobs = std::make_unique<JobSystem>(worker_threads);
+    }
+    if (pipelined) {
+      m_event->set_polled(true);
+      m_pipelined = true;
+    }
+  };
 
   EngineBackend m_backend;
   std::shared_ptr<EventHandler> m_event;
   std::shared_ptr<ActionHandler> m_action;
-  float m_dt = 0.0f;
+  std::unique_ptr<JobSystem> m_jobs;
+  // Declared before the pipeline: members destroy in reverse order, so the
+  // pipeline worker joins before the world (and the job system it ticks
+  // with) goes away.
   World m_world;
+  std::unique_ptr<FramePipeline> m_pipeline;
+  TaskScheduler m_tasks;
+  bool m_pipelined = false;
+  float m_dt = 0.0f;
 };
 
 namespace detail {
@@ -66,6 +240,13 @@ static auto get_raw_engine() -> std::unique_ptr<Engine> * {
 static auto engine() -> Engine * { return detail::get_raw_engine()->get(); }
 
 static auto initialize_meshi_engine(EngineInfo info) -> void {
+  // Touch the arena before the engine singleton's static so function-local
+  // static destruction order tears the engine (world, pipeline worker, live
+  // actors) down first and the arena that backs those objects last. Without
+  // this the arena is first constructed on the first spawn — after the engine
+  // static — and ~ObjectArena would destroy every live object while the
+  // engine still references them.
+  detail::object_arena();
   *detail::get_raw_engine() =
       std::make_unique<Engine>(Engine::make(info).unwrap());
 }
@@ -2,10 +2,16 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <cassert>
 #include <cstdint>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include <meshi.h>
 #include "meshi/types.hpp"
+#include <meshi/bits/frustum_culler.hpp>
+#include <meshi/bits/util/slice.hpp>
 
 namespace meshi {
 
@@ -21,6 +27,102 @@ public:
     return api_->gfx_create_render_object(m_gfx, &ffi_info);
   }
 
+  // Resolves a mesh name to a stable asset handle. The string hash and
+  // registry lookup happen once, at load time; repeated calls with the same
+  // name return the same handle.
+  auto resolve_mesh(const char *name) -> Handle<gfx::Mesh> {
+    return api_->gfx_resolve_mesh(m_gfx, name);
+  }
+
+  // Creates a renderable from a pre-resolved mesh handle, so steady-state
+  // spawning never touches string hashing in the plugin.
+  auto create_renderable(const gfx::ResolvedRenderableCreateInfo &info)
+      -> Handle<gfx::Renderable> {
+    MeshiMat4 t = to_meshi_mat4(info.transform);
+    return api_->gfx_create_render_object_from_mesh(m_gfx, info.mesh, &t);
+  }
+
+  // Creates a whole batch of renderables in one plugin call, e.g. when a
+  // streamed chunk spawns. Handles are written element-for-element into
+  // out_handles; both slices must be the same length.
+  auto create_renderables(Slice<gfx::RenderableCreateInfo> infos,
+                          Slice<Handle<gfx::Renderable>> out_handles) -> void {
+    assert(infos.size() == out_handles.size());
+    m_scratch_infos.resize(infos.size());
+    for (std::size_t i = 0; i < infos.size(); ++i) {
+      auto &info = infos.data()[i];
+      m_scratch_infos[i] = MeshiRenderObjectInfo{
+          info.mesh,
+          info.material,
+          to_meshi_mat4(info.transform),
+      };
+    }
+    api_->gfx_create_render_objects(m_gfx, m_scratch_infos.data(),
+                                    out_handles.data(), infos.size());
+  }
+
+  // Queues the load and returns a ticket immediately; the disk read and GPU
+  // upload happen inside later engine updates under a per-frame budget, so
+  // spawning never stalls the frame on asset residency.
+  auto create_renderable_async(const gfx::RenderableCreateInfo &info)
+      -> Handle<gfx::AsyncRenderable> {
+    MeshiRenderObjectInfo ffi_info{
+        info.mesh,
+        info.material,
+        to_meshi_mat4(info.transform),
+    };
+    return api_->gfx_create_render_object_async(m_gfx, &ffi_info);
+  }
+
+  // Polls a ticket from create_renderable_async. Ready consumes the ticket
+  // and writes the live renderable handle to out_renderable.
+  auto poll_renderable(Handle<gfx::AsyncRenderable> ticket,
+                       Handle<gfx::Renderable> *out_renderable)
+      -> gfx::AsyncLoadState {
+    switch (api_->gfx_poll_async_render_object(m_gfx, ticket, out_renderable)) {
+    case 1:
+      return gfx::AsyncLoadState::Ready;
+    case 0:
+      return gfx::AsyncLoadState::Pending;
+    default:
+      return gfx::AsyncLoadState::Invalid;
+    }
+  }
+
+  // Caps how long each engine update spends completing queued async loads.
+  void set_async_load_budget(float milliseconds) {
+    api_->gfx_set_async_load_budget(m_gfx, milliseconds);
+  }
+
+  // Creates a whole forest/crowd of one mesh behind a single handle: the mesh
+  // resolves once and the instance transforms cross the boundary in one call,
+  // instead of one create and one handle per copy. glm::mat4 is
+  // layout-compatible with MeshiMat4, so the array uploads without a copy.
+  auto create_instanced_renderable(const char *mesh, const char *material,
+                                   Slice<glm::mat4> instances)
+      -> Handle<gfx::InstancedRenderable> {
+    MeshiRenderObjectInfo ffi_info{mesh, material, to_meshi_mat4(glm::mat4(1.0f))};
+    return api_->gfx_create_instanced_render_object(
+        m_gfx, &ffi_info,
+        reinterpret_cast<const MeshiMat4 *>(instances.data()),
+        instances.size());
+  }
+
+  // Refreshes the transforms of instances [first, first + transforms.size())
+  // of a group in one call. Returns the number of instances updated.
+  auto update_instances(Handle<gfx::InstancedRenderable> group,
+                        Slice<glm::mat4> transforms, std::size_t first = 0)
+      -> std::size_t {
+    return api_->gfx_update_instance_transforms(
+        m_gfx, group, reinterpret_cast<const MeshiMat4 *>(transforms.data()),
+        first, transforms.size());
+  }
+
+  // Releases a group and every instance it owns.
+  void release_instanced_renderable(Handle<gfx::InstancedRenderable> &group) {
+    api_->gfx_release_instanced_render_object(m_gfx, &group);
+  }
+
   auto create_directional_light(const gfx::DirectionalLightInfo &info)
       -> Handle<gfx::DirectionalLight> {
     MeshiLightInfo ffi{};
@@ -43,6 +145,39 @@ public:
     api_->gfx_set_transform(m_gfx, renderable, &t);
   }
 
+  // Submits a batch of transform updates in a single plugin call. Both slices
+  // must be the same length. glm::mat4 is layout-compatible with MeshiMat4, so
+  // the matrices cross the boundary without a per-object copy.
+  void set_transforms(Slice<Handle<gfx::Renderable>> renderables,
+                      Slice<glm::mat4> transforms) {
+    assert(renderables.size() == transforms.size());
+    api_->gfx_set_transforms(
+        m_gfx, renderables.data(),
+        reinterpret_cast<const MeshiMat4 *>(transforms.data()),
+        renderables.size());
+  }
+
+  // Queues a transform update for submission at the end of the frame. The
+  // whole queue crosses the plugin boundary once in flush_queued_transforms().
+  // Safe to call from the parallel World::update workers.
+  void queue_transform(Handle<gfx::Renderable> &renderable,
+                       const glm::mat4 &transform) {
+    std::lock_guard<std::mutex> lock(*m_queue_mutex);
+    m_queued_renderables.push_back(renderable);
+    m_queued_transforms.push_back(transform);
+  }
+
+  // Flushes every transform queued since the last flush as one batched call.
+  // Called once per frame by the engine after the world has updated.
+  void flush_queued_transforms() {
+    if (m_queued_renderables.empty()) {
+      return;
+    }
+    set_transforms(m_queued_renderables, m_queued_transforms);
+    m_queued_renderables.clear();
+    m_queued_transforms.clear();
+  }
+
   auto register_display(const gfx::DisplayInfo &info) -> Handle<gfx::Display> {
     MeshiDisplayInfo ffi_info{};
     ffi_info.vsync = static_cast<int32_t>(info.vsync);
@@ -68,12 +203,34 @@ public:
                             const glm::mat4 &transform) {
     MeshiMat4 t = to_meshi_mat4(transform);
     api_->gfx_set_camera_transform(m_gfx, camera, &t);
+    // Captured for the cull pass; with several cameras the last writer wins.
+    m_cull_camera_transform = transform;
+    m_has_cull_camera = true;
   }
 
   void set_camera_projection(Handle<gfx::Camera> &camera,
                              const glm::mat4 &projection_matrix) {
     MeshiMat4 t = to_meshi_mat4(projection_matrix);
     api_->gfx_set_camera_projection(m_gfx, camera, &t);
+    m_cull_projection = projection_matrix;
+    m_has_cull_projection = true;
+  }
+
+  // Bounding-sphere registry consulted by renderable components; run_cull_pass
+  // refreshes its visibility bits once per frame.
+  inline auto culler() -> FrustumCuller & { return m_culler; }
+
+  // Batch-tests every registered bounding sphere against the frustum of the
+  // camera captured last frame. Runs before the world updates, so components
+  // read fresh visibility during their own update; a sphere that moved this
+  // frame is retested next frame.
+  void run_cull_pass() {
+    if (!m_has_cull_camera || !m_has_cull_projection) {
+      m_culler.mark_all_visible();
+      return;
+    }
+    m_culler.run(Frustum::from_view_projection(
+        m_cull_projection * glm::inverse(m_cull_camera_transform)));
   }
   
   inline auto capture_mouse(bool value) -> void {
@@ -85,6 +242,11 @@ private:
   explicit GraphicsSystem(const MeshiPluginApi *api, RawGraphicsSystem *ptr)
       : api_(api), m_gfx(ptr) {}
   ~GraphicsSystem() = default;
+  // The user-declared destructor suppresses the implicit moves and the mutex
+  // member deletes the copies, so spell the moves out: EngineBackend
+  // move-assigns this wrapper during setup.
+  GraphicsSystem(GraphicsSystem &&) = default;
+  auto operator=(GraphicsSystem &&) -> GraphicsSystem & = default;
 
   static MeshiMat4 to_meshi_mat4(const glm::mat4 &m) {
     MeshiMat4 out{};
@@ -94,6 +256,16 @@ private:
 
   const MeshiPluginApi *api_{};
   RawGraphicsSystem *m_gfx{};
+  // Behind a pointer so GraphicsSystem stays movable during backend setup.
+  std::unique_ptr<std::mutex> m_queue_mutex = std::make_unique<std::mutex>();
+  std::vector<Handle<gfx::Renderable>> m_queued_renderables;
+  std::vector<glm::mat4> m_queued_transforms;
+  std::vector<MeshiRenderObjectInfo> m_scratch_infos;
+  FrustumCuller m_culler;
+  glm::mat4 m_cull_camera_transform = glm::mat4(1.0f);
+  glm::mat4 m_cull_projection = glm::mat4(1.0f);
+  bool m_has_cull_camera = false;
+  bool m_has_cull_projection = false;
 };
 
 } // namespace meshi
@@ -2,8 +2,13 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 #include <meshi.h>
 #include "meshi/types.hpp"
+#include <meshi/bits/util/slice.hpp>
 
 namespace meshi {
 
@@ -52,6 +57,169 @@ public:
     return status;
   }
 
+  // Reads back position/rotation for a batch of bodies in a single plugin
+  // call. Both slices must be the same length. Entries whose handle does not
+  // reference a valid body keep their previous contents.
+  void get_statuses(Slice<Handle<RigidBody>> bodies,
+                    Slice<PhysicsActorStatus> out_statuses) {
+    assert(bodies.size() == out_statuses.size());
+    m_scratch_statuses.resize(bodies.size());
+    for (std::size_t i = 0; i < bodies.size(); ++i) {
+      auto &status = out_statuses.data()[i];
+      m_scratch_statuses[i].position = {status.position.x, status.position.y,
+                                        status.position.z};
+      m_scratch_statuses[i].rotation = {status.rotation.x, status.rotation.y,
+                                        status.rotation.z, status.rotation.w};
+    }
+    api_->physx_get_rigid_body_statuses(m_phys, bodies.data(),
+                                        m_scratch_statuses.data(),
+                                        bodies.size());
+    for (std::size_t i = 0; i < bodies.size(); ++i) {
+      auto &ffi = m_scratch_statuses[i];
+      out_statuses.data()[i].position = {ffi.position.x, ffi.position.y,
+                                         ffi.position.z};
+      out_statuses.data()[i].rotation = {ffi.rotation.w, ffi.rotation.x,
+                                         ffi.rotation.y, ffi.rotation.z};
+    }
+  }
+
+  // Runs the simulation on a fixed timestep of `step_secs` seconds. Updates
+  // then accumulate the frame's dt and step in whole ticks, decoupling
+  // simulation cost from the display refresh rate; tracked-status readback
+  // switches to interpolated snapshots. Zero restores variable stepping.
+  void set_fixed_timestep(float step_secs) {
+    m_fixed_timestep = step_secs > 0.0f ? step_secs : 0.0f;
+    api_->physx_set_fixed_timestep(m_phys, step_secs);
+  }
+
+  auto fixed_timestep() const -> float { return m_fixed_timestep; }
+
+  // Blend factor between the last two ticks (0 = previous, 1 = current);
+  // always 1.0 under variable stepping.
+  auto interpolation_alpha() -> float {
+    return api_->physx_get_interpolation_alpha(m_phys);
+  }
+
+  // Status blended between the last two simulation steps.
+  auto get_rigid_body_status_interpolated(Handle<RigidBody> &rigidBody,
+                                          float alpha) -> PhysicsActorStatus {
+    MeshiActorStatus ffi{};
+    api_->physx_get_rigid_body_status_interpolated(m_phys, &rigidBody, alpha,
+                                                   &ffi);
+    PhysicsActorStatus status{};
+    status.position = {ffi.position.x, ffi.position.y, ffi.position.z};
+    status.rotation = {ffi.rotation.w, ffi.rotation.x, ffi.rotation.y,
+                       ffi.rotation.z};
+    return status;
+  }
+
+  // Batched variant of get_rigid_body_status_interpolated. Both slices must
+  // be the same length; entries whose handle does not reference a valid body
+  // keep their previous contents.
+  void get_statuses_interpolated(Slice<Handle<RigidBody>> bodies,
+                                 Slice<PhysicsActorStatus> out_statuses,
+                                 float alpha) {
+    assert(bodies.size() == out_statuses.size());
+    m_scratch_statuses.resize(bodies.size());
+    for (std::size_t i = 0; i < bodies.size(); ++i) {
+      auto &status = out_statuses.data()[i];
+      m_scratch_statuses[i].position = {status.position.x, status.position.y,
+                                        status.position.z};
+      m_scratch_statuses[i].rotation = {status.rotation.x, status.rotation.y,
+                                        status.rotation.z, status.rotation.w};
+    }
+    api_->physx_get_rigid_body_statuses_interpolated(
+        m_phys, bodies.data(), alpha, m_scratch_statuses.data(),
+        bodies.size());
+    for (std::size_t i = 0; i < bodies.size(); ++i) {
+      auto &ffi = m_scratch_statuses[i];
+      out_statuses.data()[i].position = {ffi.position.x, ffi.position.y,
+                                         ffi.position.z};
+      out_statuses.data()[i].rotation = {ffi.rotation.w, ffi.rotation.x,
+                                         ffi.rotation.y, ffi.rotation.z};
+    }
+  }
+
+  // Zero-copy view of the contacts produced by the most recent physics step.
+  // The slice aliases plugin-owned memory and is invalidated by the next
+  // engine update; do not hold it across frames.
+  auto contacts() -> Slice<const ContactInfo> {
+    const ContactInfo *data = nullptr;
+    std::size_t count = 0;
+    api_->physx_map_contacts(m_phys, &data, &count);
+    return Slice<const ContactInfo>(data, count);
+  }
+
+  // Like contacts(), but empty unless the plugin has published a new contact
+  // snapshot since the last call, so callers walk each snapshot exactly once.
+  auto new_contacts() -> Slice<const ContactInfo> {
+    const ContactInfo *data = nullptr;
+    std::size_t count = 0;
+    const auto sequence = api_->physx_map_contacts(m_phys, &data, &count);
+    if (sequence == m_consumed_contact_sequence) {
+      return {};
+    }
+    m_consumed_contact_sequence = sequence;
+    return Slice<const ContactInfo>(data, count);
+  }
+
+  // Registers a body for the once-per-frame batched readback. Tracked bodies
+  // have their status refreshed by update_tracked_statuses() so per-component
+  // queries read a cache instead of crossing the plugin boundary each.
+  void track_rigid_body(Handle<RigidBody> body) {
+    if (!body.valid() || tracked_index(body) != NOT_TRACKED) {
+      return;
+    }
+    if (m_slot_to_tracked.size() <= body.slot) {
+      m_slot_to_tracked.resize(body.slot + 1, NOT_TRACKED);
+    }
+    m_slot_to_tracked[body.slot] = m_tracked_handles.size();
+    m_tracked_handles.push_back(body);
+    m_tracked_statuses.emplace_back();
+  }
+
+  void untrack_rigid_body(Handle<RigidBody> body) {
+    const auto index = tracked_index(body);
+    if (index == NOT_TRACKED) {
+      return;
+    }
+    const auto last = m_tracked_handles.size() - 1;
+    if (index != last) {
+      m_tracked_handles[index] = m_tracked_handles[last];
+      m_tracked_statuses[index] = m_tracked_statuses[last];
+      m_slot_to_tracked[m_tracked_handles[index].slot] = index;
+    }
+    m_tracked_handles.pop_back();
+    m_tracked_statuses.pop_back();
+    m_slot_to_tracked[body.slot] = NOT_TRACKED;
+  }
+
+  // Refreshes every tracked body's cached status with one plugin crossing.
+  // Called once per frame by the engine before the world updates.
+  void update_tracked_statuses() {
+    if (m_tracked_handles.empty()) {
+      return;
+    }
+    if (m_fixed_timestep > 0.0f) {
+      // Under fixed stepping the cache holds a consistent snapshot blended
+      // between the last two ticks, so motion stays smooth at any frame rate.
+      get_statuses_interpolated(m_tracked_handles, m_tracked_statuses,
+                                interpolation_alpha());
+    } else {
+      get_statuses(m_tracked_handles, m_tracked_statuses);
+    }
+  }
+
+  // Returns the status captured by the last update_tracked_statuses() call,
+  // falling back to a direct query for untracked bodies.
+  auto cached_status(Handle<RigidBody> body) -> PhysicsActorStatus {
+    const auto index = tracked_index(body);
+    if (index == NOT_TRACKED) {
+      return get_rigid_body_status(body);
+    }
+    return m_tracked_statuses[index];
+  }
+
 private:
   friend class EngineBackend;
   PhysicsSystem() = default;
@@ -59,8 +227,29 @@ private:
       : api_(api), m_phys(ptr) {}
   ~PhysicsSystem() = default;
 
+  static constexpr std::size_t NOT_TRACKED = ~std::size_t(0);
+
+  auto tracked_index(Handle<RigidBody> body) const -> std::size_t {
+    if (body.slot >= m_slot_to_tracked.size()) {
+      return NOT_TRACKED;
+    }
+    const auto index = m_slot_to_tracked[body.slot];
+    if (index == NOT_TRACKED || !(m_tracked_handles[index] == body)) {
+      return NOT_TRACKED;
+    }
+    return index;
+  }
+
   const MeshiPluginApi *api_{};
   RawPhysicsSystem *m_phys{};
+  std::vector<MeshiActorStatus> m_scratch_statuses;
+  // Dense tracked set plus a slot-indexed lookup, pool-style: track/untrack
+  // are O(1) swap-removes and the batched readback walks contiguous arrays.
+  std::vector<Handle<RigidBody>> m_tracked_handles;
+  std::vector<PhysicsActorStatus> m_tracked_statuses;
+  std::vector<std::size_t> m_slot_to_tracked;
+  std::uint64_t m_consumed_contact_sequence = 0;
+  float m_fixed_timestep = 0.0f;
 };
 
 } // namespace meshi
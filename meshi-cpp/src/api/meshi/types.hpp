@@ -10,15 +10,38 @@ using EngineBackendInfo = MeshiEngineInfo;
 using RawEngineBackend = MeshiEngine;
 using RawGraphicsSystem = MeshiEngine;
 using RawPhysicsSystem = MeshiEngine;
+using RawAudioSystem = MeshiEngine;
 
 template <typename T> using Handle = MeshiHandle;
 
 namespace gfx {
 using Renderable = MeshiRenderObjectHandle;
+using Mesh = MeshiMeshAssetHandle;
 struct RenderableCreateInfo {
   const char *mesh = "";
   const char *material = "";
   glm::mat4 transform = glm::mat4(1.0f);
+  // Bounding-sphere radius for the CPU frustum cull pass. Zero opts the
+  // renderable out of culling; it then submits whenever it moves.
+  float cull_radius = 0.0f;
+};
+// Variant of RenderableCreateInfo for assets resolved up front with
+// GraphicsSystem::resolve_mesh; spawning with it never touches string
+// hashing in the plugin.
+struct ResolvedRenderableCreateInfo {
+  Handle<Mesh> mesh{};
+  glm::mat4 transform = glm::mat4(1.0f);
+};
+// Ticket for a renderable whose asset loads asynchronously; poll it through
+// GraphicsSystem::poll_renderable to claim the live handle.
+using AsyncRenderable = MeshiAsyncRenderLoadHandle;
+// A whole group of instances of one mesh behind a single handle; create it
+// with GraphicsSystem::create_instanced_renderable.
+using InstancedRenderable = MeshiInstanceGroupHandle;
+enum class AsyncLoadState {
+  Pending,
+  Ready,
+  Invalid,
 };
 using Display = MeshiDisplayHandle;
 struct DisplayInfo {
@@ -39,6 +62,12 @@ struct DirectionalLightInfo {
 };
 } // namespace gfx
 
+namespace audio {
+using Source = MeshiAudioSourceHandle;
+using Bus = MeshiAudioBusHandle;
+using PlaybackState = MeshiPlaybackState;
+} // namespace audio
+
 using PhysicsMaterial = MeshiMaterial;
 using PhysicsMaterialCreateInfo = MeshiMaterialInfo;
 using RigidBody = MeshiRigidBody;
@@ -51,6 +80,7 @@ struct RigidBodyCreateInfo {
   MeshiCollisionShape collision_shape{};
 };
 using ForceApplyInfo = MeshiForceApplyInfo;
+using ContactInfo = MeshiContactInfo;
 struct PhysicsActorStatus {
   glm::vec3 position{0.0f};
   glm::quat rotation{1.0f, 0.0f, 0.0f, 0.0f};
@@ -1,40 +1,332 @@
 #pragma once
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <meshi/bits/broadphase.hpp>
 #include <meshi/bits/objects/base.hpp>
 #include <meshi/bits/objects/actor.hpp>
+#include <meshi/bits/objects/denizen.hpp>
 #include <meshi/bits/error.hpp>
+#include <meshi/bits/util/job_system.hpp>
+#include <type_traits>
 namespace meshi {
 struct WorldInfo {
 };
 
 struct SpawnInfo {};
+
+// Dense registry of spawned actors. Each actor holds its index, so despawn
+// is an O(1) swap-remove and the per-frame passes walk one packed array
+// instead of chasing a heap-scattered object graph. Transform data itself
+// stays on the actors: their caches are pull-based, and mirroring them here
+// per frame proved to be pure copy overhead with no reader.
+class ActorStore {
+public:
+  inline auto insert(Actor *actor) -> std::size_t {
+    auto index = m_actors.size();
+    m_actors.push_back(actor);
+    return index;
+  }
+
+  // Swap-removes the entry at index. Returns the actor that moved into its
+  // place so the caller can patch that actor's stored index, or null when the
+  // removed entry was last.
+  inline auto remove(std::size_t index) -> Actor * {
+    const auto last = m_actors.size() - 1;
+    Actor *moved = nullptr;
+    if (index != last) {
+      m_actors[index] = m_actors[last];
+      moved = m_actors[index];
+    }
+    m_actors.pop_back();
+    return moved;
+  }
+
+  inline auto clear() -> void { m_actors.clear(); }
+
+  [[nodiscard]] inline auto size() const -> std::size_t {
+    return m_actors.size();
+  }
+
+  inline auto actors() -> std::vector<Actor *> & { return m_actors; }
+
+private:
+  std::vector<Actor *> m_actors;
+};
+
 class World : private Object {
 public:
-  World() = default;
+  // Evaluated per active scripted actor each frame to (re)assign its tick
+  // tier — e.g. by distance to the camera transform. Keep it cheap; it runs
+  // inside the per-frame active pass.
+  using TickRateHook = std::function<TickRate(Actor &)>;
+
+  // Explicit region (cell) handle for streaming-scale activation. Every world
+  // starts with DEFAULT_REGION, which is always present and holds actors that
+  // were never assigned elsewhere.
+  using RegionId = std::uint32_t;
+  static constexpr RegionId DEFAULT_REGION = 0;
+
+  World() { m_regions.resize(1); }
+
+  inline auto set_tick_rate_hook(TickRateHook hook) -> void {
+    m_tick_rate_hook = std::move(hook);
+  }
+
+  // Allocates a new region, active by default. Regions are never destroyed;
+  // a streamed-out chunk just stays deactivated and empty.
+  inline auto create_region() -> RegionId {
+    m_regions.push_back({});
+    return static_cast<RegionId>(m_regions.size() - 1);
+  }
+
+  // Flips one bit: the region's actors drop out of (or back into) the update
+  // walk wholesale, with no per-actor virtual activate/deactivate chain.
+  inline auto set_region_active(RegionId region, bool active) -> void {
+    if (region < m_regions.size()) {
+      m_regions[region].active = active;
+    }
+  }
+
+  [[nodiscard]] inline auto region_active(RegionId region) const -> bool {
+    return region < m_regions.size() && m_regions[region].active;
+  }
+
+  // Moves an actor into a region's dense array. O(1) either side; the update
+  // walk iterates region by region, so co-located actors stay adjacent in
+  // the tick buckets.
+  inline auto set_region(Actor *actor, RegionId region) -> void {
+    if (region >= m_regions.size() || actor->m_region == region) {
+      return;
+    }
+    remove_from_region(actor);
+    insert_into_region(actor, region);
+  }
+
+  // Spawned actors are appended straight to the store — there is no deferred
+  // world rescan.
   template <typename T> inline auto spawn_object() -> T * {
-    m_dirty = true;
-    return this->add_subobject<T>();
+    auto *object = this->add_subobject<T>();
+    if constexpr (std::is_base_of_v<Actor, T>) {
+      object->m_store_index = m_store.insert(object);
+      insert_into_region(object, DEFAULT_REGION);
+    }
+    return object;
   }
 
-  inline auto update(float dt) -> void {
-    if (m_dirty) {
-      cache_world();
-      m_dirty = false;
+  // Removes an actor spawned via spawn_object. Swap-removes its store entry,
+  // so despawning costs O(1) regardless of world size.
+  inline auto despawn_object(Actor *actor) -> void {
+    const auto index = actor->m_store_index;
+    if (index >= m_store.size() || m_store.actors()[index] != actor) {
+      return;
+    }
+    auto *moved = m_store.remove(index);
+    if (moved != nullptr) {
+      moved->m_store_index = index;
+    }
+    actor->m_store_index = ~std::size_t(0);
+    remove_from_region(actor);
+    this->remove_subobject(actor);
+  }
+
+  // Ticks active actors in active regions by tick bucket: every-frame actors
+  // run each call, the lower tiers only on their (phase-offset) period. Each
+  // actor records the world time of its own last tick and receives the full
+  // elapsed time since then, so dt stays correct even when the hook migrates
+  // it between tiers mid-stream. When a JobSystem is supplied the due ticks
+  // run in parallel across its workers; actors are bucketed into waves by
+  // parent depth so a parent always finishes before its children run.
+  inline auto update(float dt, JobSystem *jobs = nullptr) -> void {
+    const auto frame = m_frame_index++;
+    m_now += dt;
+    bool due[TICK_BUCKET_COUNT];
+    for (std::size_t b = 0; b < TICK_BUCKET_COUNT; ++b) {
+      due[b] = frame % TICK_PERIODS[b] == TICK_PHASES[b];
+    }
+
+    // Region-ordered active pass: inactive cells are skipped wholesale, so a
+    // streamed-out chunk costs nothing here, and active cells rebuild the
+    // dense active list and the tick buckets in one walk. Iterating cell by
+    // cell keeps co-located actors adjacent in the buckets.
+    m_active_actors.clear();
+    for (auto &bucket : m_tick_buckets) {
+      bucket.clear();
+    }
+    for (auto &region : m_regions) {
+      if (!region.active) {
+        continue;
+      }
+      for (auto *actor : region.actors) {
+        if (!actor->active()) {
+          continue;
+        }
+        m_active_actors.push_back(actor);
+        if (actor->scripted()) {
+          if (m_tick_rate_hook) {
+            actor->set_tick_rate(m_tick_rate_hook(*actor));
+          }
+          const auto b = static_cast<std::size_t>(actor->tick_rate());
+          m_tick_buckets[b].push_back(actor);
+        }
+      }
+    }
+
+    if (jobs) {
+      update_parallel(due, dt, *jobs);
+      update_broadphase();
+      return;
     }
 
-    for (auto *actor : m_actors) {
-      if (actor->active()) {
-        actor->update(dt);
+    // Only actors with scripted behavior pay for a virtual dispatch; data-only
+    // actors opt out via Actor::set_scripted(false) — their transform caches
+    // are pull-based and refresh when someone actually reads them. Each
+    // bucket is a dense array, so frames that skip a tier never touch its
+    // actors.
+    for (std::size_t b = 0; b < TICK_BUCKET_COUNT; ++b) {
+      if (!due[b]) {
+        continue;
+      }
+      for (auto *actor : m_tick_buckets[b]) {
+        tick_actor(actor, dt);
       }
     }
+
+    update_broadphase();
   }
 
+  inline auto store() -> ActorStore & { return m_store; }
+  inline auto broadphase() -> Broadphase & { return m_broadphase; }
+
 private:
-  inline auto cache_world() -> void {
-    this->filter_subobjects<Actor>(&m_actors);
+  struct Region {
+    std::vector<Actor *> actors;
+    bool active = true;
+  };
+
+  inline auto insert_into_region(Actor *actor, RegionId region) -> void {
+    actor->m_region = region;
+    actor->m_region_index = m_regions[region].actors.size();
+    m_regions[region].actors.push_back(actor);
   }
 
-  bool m_dirty = true;
-  std::vector<Actor *> m_actors;
+  // Swap-removes the actor from its region's dense array and patches the
+  // moved actor's stored index.
+  inline auto remove_from_region(Actor *actor) -> void {
+    auto &cell = m_regions[actor->m_region].actors;
+    const auto index = actor->m_region_index;
+    if (index >= cell.size() || cell[index] != actor) {
+      return;
+    }
+    cell[index] = cell.back();
+    cell[index]->m_region_index = index;
+    cell.pop_back();
+    actor->m_region_index = ~std::size_t(0);
+  }
+
+  static constexpr std::size_t TICK_BUCKET_COUNT = 3;
+  // Frame periods per TickRate tier, indexed by the enum value.
+  static constexpr std::uint32_t TICK_PERIODS[TICK_BUCKET_COUNT] = {1, 4, 16};
+  // Per-tier frame offsets. The 4th tier fires on frame % 4 == 1 and the
+  // 16th on frame % 16 == 2, so the slow tiers never land on the same frame
+  // and every 16th frame doesn't tick the whole world at once.
+  static constexpr std::uint32_t TICK_PHASES[TICK_BUCKET_COUNT] = {0, 1, 2};
+
+  // Ticks one scripted actor with the elapsed time since that actor's own
+  // last tick. Per-actor bookkeeping, not per-bucket: an actor the hook
+  // migrates between tiers must neither re-receive time it already consumed
+  // nor lose the frames it sat in a slower bucket.
+  inline auto tick_actor(Actor *actor, float frame_dt) -> void {
+    const auto last = actor->m_last_tick_time;
+    actor->m_last_tick_time = m_now;
+    actor->update(last < 0.0 ? frame_dt : static_cast<float>(m_now - last));
+  }
+
+  inline auto update_parallel(const bool *due, float dt, JobSystem &jobs)
+      -> void {
+    auto &actors = m_store.actors();
+
+    for (auto &wave : m_depth_waves) {
+      wave.clear();
+    }
+    for (auto *actor : m_active_actors) {
+      std::size_t depth = 0;
+      for (auto *parent = actor->owner(); parent != nullptr;
+           parent = parent->owner()) {
+        ++depth;
+      }
+      if (m_depth_waves.size() <= depth) {
+        m_depth_waves.resize(depth + 1);
+      }
+      m_depth_waves[depth].push_back(actor->store_index());
+    }
+
+    constexpr std::size_t CHUNK_SIZE = 64;
+    for (auto &wave : m_depth_waves) {
+      if (wave.empty()) {
+        continue;
+      }
+      jobs.parallel_for(wave.size(), CHUNK_SIZE, [&](std::size_t n) {
+        const auto i = wave[n];
+        if (actors[i]->scripted()) {
+          const auto b = static_cast<std::size_t>(actors[i]->tick_rate());
+          if (due[b]) {
+            tick_actor(actors[i], dt);
+          }
+        }
+      });
+      // Settle this wave's transform caches before its children dispatch.
+      // The caches are lazily written with no synchronization, so two child
+      // actors on different workers must never find a shared parent dirty:
+      // this serial pull leaves every wave member's actor and component
+      // chain clean, and the next wave only reads them.
+      for (const auto i : wave) {
+        actors[i]->world_transform();
+      }
+    }
+  }
+
+  // Rebuilds the spatial hash from every active denizen's bounds, then hands
+  // each one only the candidates found nearby. Runs after movement so the
+  // hash reflects this frame's positions.
+  inline auto update_broadphase() -> void {
+    auto denizens = this->subobjects<Denizen>();
+    if (denizens.size() == 0) {
+      return;
+    }
+
+    m_broadphase.clear();
+    for (auto *denizen : denizens) {
+      glm::vec3 min{}, max{};
+      if (denizen->active() && denizen->bounds(&min, &max)) {
+        m_broadphase.insert(denizen, min, max);
+      }
+    }
+
+    for (auto *denizen : denizens) {
+      glm::vec3 min{}, max{};
+      if (!denizen->active() || !denizen->bounds(&min, &max)) {
+        continue;
+      }
+      m_broadphase.query(denizen, min, max, m_broadphase_candidates);
+      if (!m_broadphase_candidates.empty()) {
+        denizen->resolve_collisions(m_broadphase_candidates);
+      }
+    }
+  }
+
+  ActorStore m_store;
+  // Cell storage; index is the RegionId. DEFAULT_REGION lives at slot 0.
+  std::vector<Region> m_regions;
   std::vector<Actor *> m_active_actors;
+  // One dense array per tick tier, rebuilt in the active pass each frame.
+  std::array<std::vector<Actor *>, TICK_BUCKET_COUNT> m_tick_buckets;
+  // Accumulated world time; actors diff against it for their per-tick dt.
+  double m_now = 0.0;
+  std::uint64_t m_frame_index = 0;
+  TickRateHook m_tick_rate_hook;
+  std::vector<std::vector<std::size_t>> m_depth_waves;
+  Broadphase m_broadphase;
+  std::vector<Denizen *> m_broadphase_candidates;
 };
 } // namespace meshi
@@ -0,0 +1,179 @@
+// Micro-benchmarks for the C++ API layer, runnable headless so merges can be
+// gated on before/after numbers.
+//
+// Where frame_bench measures whole-frame throughput, these cases isolate the
+// individual hot paths: World::update scaling with actor count, EventHandler
+// dispatch with N filters, ActionHandler dispatch with N action types, Pool
+// insert/get_ref/release churn, and the transform-submit marshaling in
+// GraphicsSystem. Each case prints iterations, total time, and ns per op.
+//
+// Usage: api_bench [worker_threads]
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <glm/glm.hpp>
+#include <meshi/meshi.hpp>
+#include <string>
+#include <vector>
+
+#include "example_helper.hpp"
+
+// In pool_bench.cpp: handle.hpp's slot-map Handle<T> conflicts with the FFI
+// Handle<T> alias meshi.hpp brings in, so the Pool case lives in its own TU.
+auto bench_pool_churn() -> void;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Keeps the optimizer from deleting a benchmark's result.
+volatile std::uint64_t g_sink = 0;
+
+auto report(const char *name, std::size_t ops, Clock::time_point begin,
+            Clock::time_point end) -> void {
+  const auto total_ms =
+      std::chrono::duration<double, std::milli>(end - begin).count();
+  std::printf("  %-40s %12zu ops  %10.3f ms  %10.1f ns/op\n", name, ops,
+              total_ms, total_ms * 1e6 / static_cast<double>(ops));
+}
+
+// An actor with no plugin-backed components; ticking it measures the API
+// layer's own per-actor cost (store walk, subobject traversal, transform
+// refresh) without plugin time mixed in.
+class EmptyActor : public meshi::Actor {};
+
+auto bench_world_update(meshi::Engine *engine) -> void {
+  std::printf("world update (empty actors):\n");
+  std::vector<meshi::Actor *> spawned;
+  std::size_t population = 0;
+  for (auto target : {std::size_t(1000), std::size_t(10000),
+                      std::size_t(100000)}) {
+    for (; population < target; ++population) {
+      auto *actor = engine->world().spawn_object<EmptyActor>();
+      actor->activate();
+      spawned.push_back(actor);
+    }
+    const auto frames = std::size_t(200000000 / target / 100);
+    const auto begin = Clock::now();
+    for (std::size_t frame = 0; frame < frames; ++frame) {
+      engine->world().update(0.016f, engine->jobs());
+    }
+    const auto end = Clock::now();
+    char name[64];
+    std::snprintf(name, sizeof(name), "%zu actors x %zu frames", target,
+                  frames);
+    report(name, target * frames, begin, end);
+  }
+  for (auto *actor : spawned) {
+    engine->world().despawn_object(actor);
+  }
+}
+
+auto make_key_event(meshi::KeyCode key) -> meshi::Event {
+  meshi::Event event{};
+  event.type = meshi::EventType::Pressed;
+  event.source = meshi::EventSource::Key;
+  event.payload.press.key = key;
+  return event;
+}
+
+// Filter counts grow within one run because filter callbacks cannot be
+// unregistered individually; each row includes the rows before it.
+auto bench_event_dispatch(meshi::Engine *engine) -> void {
+  std::printf("event dispatch (filters accumulate across rows):\n");
+  auto &handler = engine->event();
+  const auto event = make_key_event(meshi::KeyCode::Space);
+  std::size_t registered = 0;
+  for (auto target : {std::size_t(8), std::size_t(64), std::size_t(512)}) {
+    for (; registered < target; ++registered) {
+      handler.register_callback(
+          [](const meshi::Event &e) {
+            return e.type == meshi::EventType::Pressed;
+          },
+          [](const meshi::Event &) { ++g_sink; });
+    }
+    const auto iterations = std::size_t(2000000 / target);
+    const auto begin = Clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+      handler.dispatch(event);
+    }
+    const auto end = Clock::now();
+    char name[64];
+    std::snprintf(name, sizeof(name), "%zu filters", target);
+    report(name, iterations, begin, end);
+  }
+}
+
+auto bench_action_dispatch(meshi::Engine *engine) -> void {
+  std::printf("action dispatch (action types accumulate across rows):\n");
+  auto &handler = engine->action();
+  const auto event = make_key_event(meshi::KeyCode::W);
+  std::size_t registered = 0;
+  for (auto target : {std::size_t(8), std::size_t(64), std::size_t(512)}) {
+    for (; registered < target; ++registered) {
+      auto name = "bench_action_" + std::to_string(registered);
+      handler.register_action(name, meshi::ActionHandler::is_just_pressed);
+      handler.register_action_callback(
+          name, [](const meshi::Action &) { ++g_sink; });
+    }
+    const auto iterations = std::size_t(2000000 / target);
+    const auto begin = Clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+      handler.process_event(event);
+    }
+    const auto end = Clock::now();
+    char name[64];
+    std::snprintf(name, sizeof(name), "%zu action types", target);
+    report(name, iterations, begin, end);
+  }
+}
+
+auto bench_transform_marshal(meshi::Engine *engine) -> void {
+  std::printf("transform submit marshaling:\n");
+  constexpr std::size_t BATCH = 10000;
+  constexpr std::size_t FRAMES = 200;
+  auto &graphics = engine->backend().graphics();
+  // Default-constructed handles cross the boundary and are skipped plugin
+  // side, so this measures queue + marshal + FFI crossing, not draw cost.
+  meshi::Handle<meshi::gfx::Renderable> handle{};
+  const auto transform = glm::mat4(1.0f);
+  const auto begin = Clock::now();
+  for (std::size_t frame = 0; frame < FRAMES; ++frame) {
+    for (std::size_t i = 0; i < BATCH; ++i) {
+      graphics.queue_transform(handle, transform);
+    }
+    graphics.flush_queued_transforms();
+  }
+  const auto end = Clock::now();
+  char name[64];
+  std::snprintf(name, sizeof(name), "queue+flush, %zu per frame", BATCH);
+  report(name, BATCH * FRAMES, begin, end);
+}
+
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+  const auto worker_threads =
+      argc > 1 ? static_cast<std::uint32_t>(std::atoi(argv[1])) : 0u;
+
+  meshi::initialize_meshi_engine(meshi::EngineInfo{
+      .application_name = "API Bench",
+      .application_root = EXAMPLE_APP_DIR,
+      .worker_threads = worker_threads,
+      .headless = true,
+  });
+  auto *engine = meshi::engine();
+
+  std::printf("api_bench: %u workers\n", worker_threads);
+  bench_world_update(engine);
+  // Event dispatch runs before the action cases: EventHandler::dispatch feeds
+  // every event through the ActionHandler's pass-all filter, so registering
+  // the action types first would distort the event rows.
+  bench_event_dispatch(engine);
+  bench_action_dispatch(engine);
+  bench_pool_churn();
+  bench_transform_marshal(engine);
+
+  return 0;
+}
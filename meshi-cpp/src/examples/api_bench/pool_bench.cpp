@@ -0,0 +1,59 @@
+// Pool churn benchmark, in its own translation unit: handle.hpp declares the
+// slot-map Handle<T> template while meshi.hpp's types.hpp declares the FFI
+// Handle<T> alias, and the two cannot coexist in one TU.
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <meshi/bits/util/handle.hpp>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+volatile std::uint64_t g_sink = 0;
+
+auto report(const char *name, std::size_t ops, Clock::time_point begin,
+            Clock::time_point end) -> void {
+  const auto total_ms =
+      std::chrono::duration<double, std::milli>(end - begin).count();
+  std::printf("  %-40s %12zu ops  %10.3f ms  %10.1f ns/op\n", name, ops,
+              total_ms, total_ms * 1e6 / static_cast<double>(ops));
+}
+
+} // namespace
+
+auto bench_pool_churn() -> void {
+  std::printf("pool churn:\n");
+  constexpr std::size_t LIVE = 4096;
+  constexpr std::size_t CYCLES = 1000000;
+  meshi::Pool<std::uint64_t> pool(LIVE);
+  std::vector<meshi::Handle<std::uint64_t>> handles;
+  handles.reserve(LIVE);
+  for (std::size_t i = 0; i < LIVE; ++i) {
+    handles.push_back(pool.insert(i));
+  }
+
+  {
+    const auto begin = Clock::now();
+    for (std::size_t i = 0; i < CYCLES; ++i) {
+      // Release and reinsert one slot per cycle; steady-state churn over a
+      // warm pool, the common spawn/despawn pattern.
+      const auto index = i % LIVE;
+      pool.release(handles[index]);
+      handles[index] = pool.insert(i);
+    }
+    const auto end = Clock::now();
+    report("insert+release cycle", CYCLES, begin, end);
+  }
+  {
+    const auto begin = Clock::now();
+    for (std::size_t i = 0; i < CYCLES; ++i) {
+      if (auto ref = pool.get_ref(handles[i % LIVE])) {
+        g_sink += **ref;
+      }
+    }
+    const auto end = Clock::now();
+    report("get_ref hit", CYCLES, begin, end);
+  }
+}
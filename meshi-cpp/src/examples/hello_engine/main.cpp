@@ -80,7 +80,6 @@ public:
           if (meshi::ActionHandler::is_just_pressed(event, action)) {
             if (event.source == meshi::EventSource::Key &&
                 event.payload.press.key == meshi::KeyCode::W) {
-              action.type = "movement";
               return true;
             }
           }
@@ -92,7 +91,6 @@ public:
           if (meshi::ActionHandler::is_just_pressed(event, action)) {
             if (event.source == meshi::EventSource::Key &&
                 event.payload.press.key == meshi::KeyCode::A) {
-              action.type = "movement";
               return true;
             }
           }
@@ -104,7 +102,6 @@ public:
           if (meshi::ActionHandler::is_just_pressed(event, action)) {
             if (event.source == meshi::EventSource::Key &&
                 event.payload.press.key == meshi::KeyCode::D) {
-              action.type = "movement";
               return true;
             }
           }
@@ -116,7 +113,6 @@ public:
           if (meshi::ActionHandler::is_just_pressed(event, action)) {
             if (event.source == meshi::EventSource::Key &&
                 event.payload.press.key == meshi::KeyCode::S) {
-              action.type = "movement";
               return true;
             }
           }
@@ -127,7 +123,6 @@ public:
           if (meshi::ActionHandler::is_just_pressed(event, action)) {
             if (event.source == meshi::EventSource::Key &&
                 event.payload.press.key == meshi::KeyCode::ArrowUp) {
-              action.type = "movement";
               return true;
             }
           }
@@ -139,7 +134,6 @@ public:
           if (meshi::ActionHandler::is_just_pressed(event, action)) {
             if (event.source == meshi::EventSource::Key &&
                 event.payload.press.key == meshi::KeyCode::ArrowDown) {
-              action.type = "movement";
               return true;
             }
           }
@@ -151,7 +145,6 @@ public:
           if (meshi::ActionHandler::is_just_pressed(event, action)) {
             if (event.source == meshi::EventSource::Key &&
                 event.payload.press.key == meshi::KeyCode::ArrowLeft) {
-              action.type = "movement";
               return true;
             }
           }
@@ -163,7 +156,6 @@ public:
           if (meshi::ActionHandler::is_just_pressed(event, action)) {
             if (event.source == meshi::EventSource::Key &&
                 event.payload.press.key == meshi::KeyCode::ArrowRight) {
-              action.type = "movement";
               return true;
             }
           }
@@ -0,0 +1,140 @@
+// Offline asset-pack baker.
+//
+// Flattens an application asset directory (db.json, glTF/GLB geometry,
+// textures, audio — every file under the root) into a single relocatable
+// pack that AssetPack memory-maps at runtime: fixed-layout header, entry
+// table sorted by name hash, and data blobs aligned for direct GPU upload.
+// Entry names are the forward-slash relative paths, so a resolve that used
+// to open and parse "database/geometry/db.json" becomes pointer arithmetic.
+//
+// Usage: meshi_pack <asset_root> <out.meshipack>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <meshi/bits/util/asset_pack.hpp>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+struct PendingEntry {
+  std::string name;
+  std::uint64_t name_hash = 0;
+  fs::path source;
+  std::uint64_t size = 0;
+  std::uint64_t name_offset = 0;
+  std::uint64_t data_offset = 0;
+};
+
+auto align_up(std::uint64_t value, std::uint64_t alignment) -> std::uint64_t {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+  if (argc != 3) {
+    std::fprintf(stderr, "usage: meshi_pack <asset_root> <out.meshipack>\n");
+    return 1;
+  }
+  const fs::path root = argv[1];
+  if (!fs::is_directory(root)) {
+    std::fprintf(stderr, "meshi_pack: %s is not a directory\n", argv[1]);
+    return 1;
+  }
+
+  std::vector<PendingEntry> entries;
+  for (const auto &item : fs::recursive_directory_iterator(root)) {
+    if (!item.is_regular_file()) {
+      continue;
+    }
+    PendingEntry entry;
+    entry.name = fs::relative(item.path(), root).generic_string();
+    entry.name_hash = meshi::pack::hash_name(entry.name);
+    entry.source = item.path();
+    entry.size = static_cast<std::uint64_t>(item.file_size());
+    entries.push_back(std::move(entry));
+  }
+  if (entries.empty()) {
+    std::fprintf(stderr, "meshi_pack: no files under %s\n", argv[1]);
+    return 1;
+  }
+
+  // The runtime binary-searches by hash; ties broken by name keep the output
+  // deterministic for identical inputs.
+  std::sort(entries.begin(), entries.end(),
+            [](const PendingEntry &a, const PendingEntry &b) {
+              return a.name_hash != b.name_hash ? a.name_hash < b.name_hash
+                                                : a.name < b.name;
+            });
+
+  // Lay out the file: header, entry table, name strings, aligned blobs.
+  meshi::pack::PackHeader header{};
+  std::memcpy(header.magic, meshi::pack::MAGIC, sizeof(header.magic));
+  header.version = meshi::pack::VERSION;
+  header.entry_count = static_cast<std::uint32_t>(entries.size());
+  header.entry_table_offset = sizeof(meshi::pack::PackHeader);
+  header.name_table_offset =
+      header.entry_table_offset +
+      entries.size() * sizeof(meshi::pack::PackEntry);
+
+  auto cursor = header.name_table_offset;
+  for (auto &entry : entries) {
+    entry.name_offset = cursor;
+    cursor += entry.name.size() + 1;
+  }
+  header.data_offset = align_up(cursor, meshi::pack::DATA_ALIGN);
+  cursor = header.data_offset;
+  for (auto &entry : entries) {
+    entry.data_offset = cursor;
+    cursor = align_up(cursor + entry.size, meshi::pack::DATA_ALIGN);
+  }
+  header.file_size = cursor;
+
+  std::ofstream out(argv[2], std::ios::binary | std::ios::trunc);
+  if (!out) {
+    std::fprintf(stderr, "meshi_pack: cannot write %s\n", argv[2]);
+    return 1;
+  }
+  auto pad_to = [&out](std::uint64_t offset) {
+    static const char zeros[meshi::pack::DATA_ALIGN] = {};
+    auto at = static_cast<std::uint64_t>(out.tellp());
+    while (at < offset) {
+      const auto chunk = std::min<std::uint64_t>(offset - at, sizeof(zeros));
+      out.write(zeros, static_cast<std::streamsize>(chunk));
+      at += chunk;
+    }
+  };
+
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  for (const auto &entry : entries) {
+    meshi::pack::PackEntry packed{entry.name_hash, entry.name_offset,
+                                  entry.data_offset, entry.size};
+    out.write(reinterpret_cast<const char *>(&packed), sizeof(packed));
+  }
+  for (const auto &entry : entries) {
+    out.write(entry.name.c_str(),
+              static_cast<std::streamsize>(entry.name.size() + 1));
+  }
+  for (const auto &entry : entries) {
+    pad_to(entry.data_offset);
+    std::ifstream in(entry.source, std::ios::binary);
+    if (!in) {
+      std::fprintf(stderr, "meshi_pack: cannot read %s\n",
+                   entry.source.string().c_str());
+      return 1;
+    }
+    out << in.rdbuf();
+  }
+  pad_to(header.file_size);
+  out.close();
+
+  std::printf("meshi_pack: %u entries, %llu bytes -> %s\n", header.entry_count,
+              static_cast<unsigned long long>(header.file_size), argv[2]);
+  return 0;
+}
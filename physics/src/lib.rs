@@ -135,6 +135,10 @@ pub struct RigidBody {
     position: Vec3,
     velocity: Vec3,
     rotation: Quat,
+    // State at the start of the last step, kept for interpolated readback
+    // between ticks when the simulation runs on a fixed timestep.
+    prev_position: Vec3,
+    prev_rotation: Quat,
     shape: CollisionShape,
     material: Handle<Material>,
     has_gravity: u32,
@@ -311,6 +315,8 @@ impl From<&RigidBodyInfo> for RigidBody {
             position: value.initial_position,
             velocity: Default::default(),
             rotation: value.initial_rotation,
+            prev_position: value.initial_position,
+            prev_rotation: value.initial_rotation,
             shape: value.collision_shape,
             material: value.material,
             has_gravity: value.has_gravity,
@@ -337,6 +343,10 @@ pub struct PhysicsSimulation {
     rigid_bodies: Pool<RigidBody>,
     contacts: Vec<ContactInfo>,
     default_material: Handle<Material>,
+    // Fixed timestep in seconds; zero keeps the original variable stepping.
+    fixed_timestep: f32,
+    accumulator: f32,
+    interp_alpha: f32,
 }
 
 impl PhysicsSimulation {
@@ -347,6 +357,9 @@ impl PhysicsSimulation {
             rigid_bodies: Default::default(),
             contacts: Vec::new(),
             default_material: Default::default(),
+            fixed_timestep: 0.0,
+            accumulator: 0.0,
+            interp_alpha: 1.0,
         };
 
         let default = s.materials.insert(Default::default()).unwrap();
@@ -367,7 +380,63 @@ impl PhysicsSimulation {
         self.info.environment.gravity_mps = gravity_mps;
     }
 
+    /// Selects a fixed simulation timestep in seconds. Each `update` then
+    /// accumulates the caller's dt and steps in whole ticks, so simulation
+    /// cost is independent of the caller's frame rate. Zero restores
+    /// variable stepping, where each `update` advances by the caller's dt.
+    pub fn set_fixed_timestep(&mut self, step_secs: f32) {
+        self.fixed_timestep = step_secs.max(0.0);
+        self.accumulator = 0.0;
+        self.interp_alpha = 1.0;
+    }
+
+    pub fn fixed_timestep(&self) -> f32 {
+        self.fixed_timestep
+    }
+
+    /// Blend factor between the last two ticks (0 = previous, 1 = current),
+    /// i.e. how far the unconsumed accumulator sits into the next tick.
+    /// Always 1.0 under variable stepping.
+    pub fn interpolation_alpha(&self) -> f32 {
+        self.interp_alpha
+    }
+
     pub fn update(&mut self, dt: f32) -> Result<(), PhysicsError> {
+        if self.fixed_timestep <= 0.0 {
+            self.snapshot_previous_states();
+            self.interp_alpha = 1.0;
+            return self.step(dt);
+        }
+
+        // Cap the ticks consumed per update so a long stall drops backlog
+        // instead of spiraling into ever-longer updates.
+        const MAX_STEPS_PER_UPDATE: u32 = 8;
+        let mut result = Ok(());
+        self.accumulator += dt;
+        let mut steps = 0;
+        while self.accumulator >= self.fixed_timestep && steps < MAX_STEPS_PER_UPDATE {
+            self.snapshot_previous_states();
+            if let Err(e) = self.step(self.fixed_timestep) {
+                result = Err(e);
+            }
+            self.accumulator -= self.fixed_timestep;
+            steps += 1;
+        }
+        if steps == MAX_STEPS_PER_UPDATE {
+            self.accumulator = 0.0;
+        }
+        self.interp_alpha = (self.accumulator / self.fixed_timestep).clamp(0.0, 1.0);
+        result
+    }
+
+    fn snapshot_previous_states(&mut self) {
+        self.rigid_bodies.for_each_occupied_mut(|r| {
+            r.prev_position = r.position;
+            r.prev_rotation = r.rotation;
+        });
+    }
+
+    fn step(&mut self, dt: f32) -> Result<(), PhysicsError> {
         let dt_vec = vec3(dt, dt, dt);
         let mut had_invalid = false;
 
@@ -713,6 +782,24 @@ impl PhysicsSimulation {
         self.rigid_bodies.get_ref(h).map(|rb| rb.into())
     }
 
+    /// Status blended between the last two steps. `alpha` is normally
+    /// [`interpolation_alpha`](Self::interpolation_alpha), giving readers a
+    /// consistent snapshot that advances smoothly between fixed ticks.
+    pub fn get_rigid_body_status_interpolated(
+        &self,
+        h: Handle<RigidBody>,
+        alpha: f32,
+    ) -> Option<ActorStatus> {
+        if !h.valid() {
+            return None;
+        }
+        let alpha = alpha.clamp(0.0, 1.0);
+        self.rigid_bodies.get_ref(h).map(|rb| ActorStatus {
+            position: rb.prev_position.lerp(rb.position, alpha),
+            rotation: rb.prev_rotation.slerp(rb.rotation, alpha),
+        })
+    }
+
     pub fn get_rigid_body_velocity(&self, h: Handle<RigidBody>) -> Option<Vec3> {
         if !h.valid() {
             return None;
@@ -723,4 +810,23 @@ impl PhysicsSimulation {
     pub fn get_contacts(&self) -> &[ContactInfo] {
         &self.contacts
     }
+
+    /// Number of live rigid bodies, for the engine's memory accounting.
+    pub fn rigid_body_count(&mut self) -> usize {
+        let mut count = 0;
+        self.rigid_bodies.for_each_occupied_mut(|_| count += 1);
+        count
+    }
+
+    /// Number of live materials (including the default material).
+    pub fn material_count(&mut self) -> usize {
+        let mut count = 0;
+        self.materials.for_each_occupied_mut(|_| count += 1);
+        count
+    }
+
+    /// Number of contacts recorded by the last step.
+    pub fn contact_count(&self) -> usize {
+        self.contacts.len()
+    }
 }
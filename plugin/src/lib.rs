@@ -15,10 +15,97 @@ use meshi_physics::{CollisionShape, CollisionShapeType, ContactInfo, ForceApplyI
 use meshi_utils::timer::Timer;
 use noren::{meta::DeviceModel, DBInfo};
 use resource_pool::Handle;
+use std::collections::HashMap;
 use std::ffi::*;
 use tracing::{info, Level};
 use tracing_subscriber::FmtSubscriber;
 
+/// Marker type for mesh assets resolved through [`meshi_gfx_resolve_mesh`].
+pub struct MeshAsset;
+
+/// Marker type for async load tickets minted by
+/// [`meshi_gfx_create_render_object_async`].
+pub struct AsyncRenderLoad;
+
+const ASYNC_LOAD_PENDING: u8 = 0;
+const ASYNC_LOAD_READY: u8 = 1;
+const ASYNC_LOAD_FREE: u8 = 2;
+
+/// One queued asset load; slots are recycled once the ticket is claimed.
+struct AsyncLoadSlot {
+    state: u8,
+    // Bumped on every allocation so stale tickets stop validating.
+    generation: u16,
+    mesh: String,
+    transform: Mat4,
+    result: Handle<RenderObject>,
+}
+
+impl Default for AsyncLoadSlot {
+    fn default() -> Self {
+        Self {
+            state: ASYNC_LOAD_FREE,
+            generation: 0,
+            mesh: String::new(),
+            transform: Mat4::IDENTITY,
+            result: Handle::default(),
+        }
+    }
+}
+
+/// Marker type for instanced renderable groups minted by
+/// [`meshi_gfx_create_instanced_render_object`].
+pub struct InstanceGroup;
+
+/// One instanced group: every instance shares the same resolved mesh and
+/// material and owns one entry in `objects`. Slots are recycled on release.
+struct InstanceGroupSlot {
+    live: bool,
+    // Bumped on every allocation so stale group handles stop validating.
+    generation: u16,
+    objects: Vec<Handle<RenderObject>>,
+}
+
+impl Default for InstanceGroupSlot {
+    fn default() -> Self {
+        Self {
+            live: false,
+            generation: 0,
+            objects: Vec::new(),
+        }
+    }
+}
+
+/// Per-system timings for the most recent engine update, in milliseconds.
+#[repr(C)]
+#[derive(Clone, Copy, Default)]
+pub struct FrameTimings {
+    pub physics_ms: f32,
+    pub render_ms: f32,
+    pub audio_ms: f32,
+    pub total_ms: f32,
+}
+
+/// Per-system resource counts for leak triage over long sessions. Graphics
+/// object/light counts track what crossed the FFI; the rest come straight
+/// from the owning system's live pools.
+#[repr(C)]
+#[derive(Clone, Copy, Default)]
+pub struct MemoryStats {
+    pub gfx_render_objects: u64,
+    pub gfx_lights: u64,
+    pub gfx_resolved_models: u64,
+    pub gfx_async_load_slots: u64,
+    pub gfx_instance_groups: u64,
+    pub gfx_instanced_objects: u64,
+    pub physx_rigid_bodies: u64,
+    pub physx_materials: u64,
+    pub physx_contacts: u64,
+    pub audio_sources: u64,
+    pub audio_streams: u64,
+    pub audio_buses: u64,
+}
+
 macro_rules! return_if_null {
     ($ret:expr, $($ptr:expr),+ $(,)?) => {
         if $( $ptr.is_null() )||* {
@@ -27,7 +114,7 @@ macro_rules! return_if_null {
     };
 }
 
-pub const MESHI_PLUGIN_ABI_VERSION: u32 = 3;
+pub const MESHI_PLUGIN_ABI_VERSION: u32 = 13;
 
 #[repr(C)]
 pub struct MeshiPluginApi {
@@ -121,6 +208,65 @@ pub struct MeshiPluginApi {
         extern "C" fn(*mut MeshiEngine, Handle<RenderObject>, Handle<RigidBody>) -> i32,
     pub unpair_render_physics:
         extern "C" fn(*mut MeshiEngine, *const Handle<RenderObject>, *const Handle<RigidBody>),
+    pub gfx_set_transforms:
+        extern "C" fn(*mut MeshiEngine, *const Handle<RenderObject>, *const Mat4, usize),
+    pub physx_get_rigid_body_statuses: extern "C" fn(
+        *mut MeshiEngine,
+        *const Handle<meshi_physics::RigidBody>,
+        *mut meshi_physics::ActorStatus,
+        usize,
+    ) -> usize,
+    pub physx_map_contacts:
+        extern "C" fn(*mut MeshiEngine, *mut *const ContactInfo, *mut usize) -> u64,
+    pub gfx_create_render_objects: extern "C" fn(
+        *mut MeshiEngine,
+        *const RenderObjectInfo,
+        *mut Handle<RenderObject>,
+        usize,
+    ) -> usize,
+    pub gfx_resolve_mesh: extern "C" fn(*mut MeshiEngine, *const c_char) -> Handle<MeshAsset>,
+    pub gfx_create_render_object_from_mesh:
+        extern "C" fn(*mut MeshiEngine, Handle<MeshAsset>, *const Mat4) -> Handle<RenderObject>,
+    pub get_frame_timings: extern "C" fn(*mut MeshiEngine, *mut FrameTimings) -> i32,
+    pub physx_set_fixed_timestep: extern "C" fn(*mut MeshiEngine, f32),
+    pub physx_get_interpolation_alpha: extern "C" fn(*mut MeshiEngine) -> f32,
+    pub physx_get_rigid_body_status_interpolated: extern "C" fn(
+        *mut MeshiEngine,
+        *const Handle<meshi_physics::RigidBody>,
+        f32,
+        *mut meshi_physics::ActorStatus,
+    ) -> i32,
+    pub physx_get_rigid_body_statuses_interpolated: extern "C" fn(
+        *mut MeshiEngine,
+        *const Handle<meshi_physics::RigidBody>,
+        f32,
+        *mut meshi_physics::ActorStatus,
+        usize,
+    ) -> usize,
+    pub gfx_create_render_object_async:
+        extern "C" fn(*mut MeshiEngine, *const RenderObjectInfo) -> Handle<AsyncRenderLoad>,
+    pub gfx_poll_async_render_object: extern "C" fn(
+        *mut MeshiEngine,
+        Handle<AsyncRenderLoad>,
+        *mut Handle<RenderObject>,
+    ) -> i32,
+    pub gfx_set_async_load_budget: extern "C" fn(*mut MeshiEngine, f32),
+    pub gfx_create_instanced_render_object: extern "C" fn(
+        *mut MeshiEngine,
+        *const RenderObjectInfo,
+        *const Mat4,
+        usize,
+    ) -> Handle<InstanceGroup>,
+    pub gfx_update_instance_transforms: extern "C" fn(
+        *mut MeshiEngine,
+        Handle<InstanceGroup>,
+        *const Mat4,
+        usize,
+        usize,
+    ) -> usize,
+    pub gfx_release_instanced_render_object:
+        extern "C" fn(*mut MeshiEngine, *const Handle<InstanceGroup>),
+    pub get_memory_stats: extern "C" fn(*mut MeshiEngine, *mut MemoryStats) -> i32,
 }
 
 pub static MESHI_PLUGIN_API: MeshiPluginApi = MeshiPluginApi {
@@ -178,6 +324,24 @@ pub static MESHI_PLUGIN_API: MeshiPluginApi = MeshiPluginApi {
     physx_collision_shape_capsule: meshi_physx_collision_shape_capsule,
     pair_render_physics: meshi_pair_render_physics,
     unpair_render_physics: meshi_unpair_render_physics,
+    gfx_set_transforms: meshi_gfx_set_transforms,
+    physx_get_rigid_body_statuses: meshi_physx_get_rigid_body_statuses,
+    physx_map_contacts: meshi_physx_map_contacts,
+    gfx_create_render_objects: meshi_gfx_create_render_objects,
+    gfx_resolve_mesh: meshi_gfx_resolve_mesh,
+    gfx_create_render_object_from_mesh: meshi_gfx_create_render_object_from_mesh,
+    get_frame_timings: meshi_get_frame_timings,
+    physx_set_fixed_timestep: meshi_physx_set_fixed_timestep,
+    physx_get_interpolation_alpha: meshi_physx_get_interpolation_alpha,
+    physx_get_rigid_body_status_interpolated: meshi_physx_get_rigid_body_status_interpolated,
+    physx_get_rigid_body_statuses_interpolated: meshi_physx_get_rigid_body_statuses_interpolated,
+    gfx_create_render_object_async: meshi_gfx_create_render_object_async,
+    gfx_poll_async_render_object: meshi_gfx_poll_async_render_object,
+    gfx_set_async_load_budget: meshi_gfx_set_async_load_budget,
+    gfx_create_instanced_render_object: meshi_gfx_create_instanced_render_object,
+    gfx_update_instance_transforms: meshi_gfx_update_instance_transforms,
+    gfx_release_instanced_render_object: meshi_gfx_release_instanced_render_object,
+    get_memory_stats: meshi_get_memory_stats,
 };
 
 #[no_mangle]
@@ -215,6 +379,27 @@ pub struct MeshiEngine {
     audio: AudioEngine,
     frame_timer: Timer,
     render_physics_pairs: Vec<RenderPhysicsPair>,
+    // Bumped every update so contact consumers can detect a fresh snapshot
+    // without copying the contact buffer.
+    contact_sequence: u64,
+    // Mesh assets resolved up front; the handle slot indexes this list, so
+    // spawns clone the cached DeviceModel instead of re-resolving the name.
+    resolved_models: Vec<DeviceModel>,
+    resolved_model_lookup: HashMap<String, u16>,
+    last_frame_timings: FrameTimings,
+    // Queued asset loads completed inside update() under a per-frame budget,
+    // so spawning never stalls a frame on disk reads or uploads.
+    async_loads: Vec<AsyncLoadSlot>,
+    async_free_slots: Vec<u16>,
+    async_pending: usize,
+    async_load_budget_ms: f32,
+    // Instanced groups: forests/crowds of one mesh held behind a single
+    // handle, created and refreshed with one call per batch.
+    instance_groups: Vec<InstanceGroupSlot>,
+    instance_group_free_slots: Vec<u16>,
+    // Live standalone render objects and lights created through the FFI.
+    render_object_count: u64,
+    light_count: u64,
 }
 
 impl MeshiEngine {
@@ -278,6 +463,18 @@ impl MeshiEngine {
             frame_timer: Timer::new(),
             name: appname.to_string(),
             render_physics_pairs: Vec::new(),
+            contact_sequence: 1,
+            resolved_models: Vec::new(),
+            resolved_model_lookup: HashMap::new(),
+            last_frame_timings: FrameTimings::default(),
+            async_loads: Vec::new(),
+            async_free_slots: Vec::new(),
+            async_pending: 0,
+            async_load_budget_ms: 2.0,
+            instance_groups: Vec::new(),
+            instance_group_free_slots: Vec::new(),
+            render_object_count: 0,
+            light_count: 0,
         }))
     }
 
@@ -286,10 +483,25 @@ impl MeshiEngine {
         let dt = self.frame_timer.elapsed_duration();
         self.frame_timer.start();
         let dt_secs = dt.as_secs_f32();
+        let frame_begin = std::time::Instant::now();
         self.sync_render_physics_pairs();
+        let physics_begin = std::time::Instant::now();
         let _ = self.physics.update(dt_secs);
+        let physics_ms = physics_begin.elapsed().as_secs_f32() * 1000.0;
+        self.contact_sequence += 1;
+        self.process_async_loads();
+        let render_begin = std::time::Instant::now();
         self.render.update(dt_secs);
+        let render_ms = render_begin.elapsed().as_secs_f32() * 1000.0;
+        let audio_begin = std::time::Instant::now();
         self.audio.update(dt_secs);
+        let audio_ms = audio_begin.elapsed().as_secs_f32() * 1000.0;
+        self.last_frame_timings = FrameTimings {
+            physics_ms,
+            render_ms,
+            audio_ms,
+            total_ms: frame_begin.elapsed().as_secs_f32() * 1000.0,
+        };
 
         dt_secs
     }
@@ -298,6 +510,78 @@ impl MeshiEngine {
         self.render.shut_down();
     }
 
+    fn resolve_model_slot(&mut self, name: &str) -> u16 {
+        match self.resolved_model_lookup.get(name) {
+            Some(&slot) => slot,
+            None => {
+                let model = self
+                    .database
+                    .fetch_gpu_model(name)
+                    .expect("Failed to  load model!");
+                let slot = self.resolved_models.len() as u16;
+                self.resolved_models.push(model);
+                self.resolved_model_lookup.insert(name.to_string(), slot);
+                slot
+            }
+        }
+    }
+
+    fn alloc_instance_group_slot(&mut self) -> u16 {
+        if let Some(slot) = self.instance_group_free_slots.pop() {
+            slot
+        } else {
+            self.instance_groups.push(InstanceGroupSlot::default());
+            (self.instance_groups.len() - 1) as u16
+        }
+    }
+
+    fn alloc_async_slot(&mut self) -> u16 {
+        if let Some(slot) = self.async_free_slots.pop() {
+            slot
+        } else {
+            self.async_loads.push(AsyncLoadSlot::default());
+            (self.async_loads.len() - 1) as u16
+        }
+    }
+
+    // Completes queued loads until the per-frame budget is spent. At least
+    // one load makes progress per update so a zero budget cannot stall the
+    // queue forever.
+    fn process_async_loads(&mut self) {
+        if self.async_pending == 0 {
+            return;
+        }
+        let begin = std::time::Instant::now();
+        let budget_ms = self.async_load_budget_ms.max(0.0);
+        let mut processed = 0;
+        for i in 0..self.async_loads.len() {
+            if self.async_pending == 0 {
+                break;
+            }
+            if processed > 0 && begin.elapsed().as_secs_f32() * 1000.0 >= budget_ms {
+                break;
+            }
+            if self.async_loads[i].state != ASYNC_LOAD_PENDING {
+                continue;
+            }
+            let name = std::mem::take(&mut self.async_loads[i].mesh);
+            let slot = self.resolve_model_slot(&name);
+            let model = self.resolved_models[slot as usize].clone();
+            let h = self
+                .render
+                .register_object(&GfxRenderObjectInfo::Model(model))
+                .expect("Unable to register object");
+            let transform = self.async_loads[i].transform;
+            self.render.set_object_transform(h, &transform);
+            let entry = &mut self.async_loads[i];
+            entry.result = h;
+            entry.state = ASYNC_LOAD_READY;
+            self.async_pending -= 1;
+            self.render_object_count += 1;
+            processed += 1;
+        }
+    }
+
     fn sync_render_physics_pairs(&mut self) {
         if self.render_physics_pairs.is_empty() {
             return;
@@ -460,6 +744,53 @@ pub extern "C" fn meshi_update(engine: *mut MeshiEngine) -> c_float {
     unsafe { &mut *engine }.update() as c_float
 }
 
+/// Copy the per-system timings of the last completed update into `out`.
+///
+/// # Safety
+/// `engine` and `out` must be valid, non-null pointers.
+#[no_mangle]
+pub extern "C" fn meshi_get_frame_timings(
+    engine: *mut MeshiEngine,
+    out: *mut FrameTimings,
+) -> i32 {
+    if engine.is_null() || out.is_null() {
+        return 0;
+    }
+    unsafe { *out = (*engine).last_frame_timings };
+    1
+}
+
+/// Fill `out` with per-system resource counts for memory triage.
+///
+/// # Safety
+/// `engine` and `out` must be valid, non-null pointers.
+#[no_mangle]
+pub extern "C" fn meshi_get_memory_stats(engine: *mut MeshiEngine, out: *mut MemoryStats) -> i32 {
+    if engine.is_null() || out.is_null() {
+        return 0;
+    }
+    let engine: &mut MeshiEngine = unsafe { &mut (*engine) };
+    let mut stats = MemoryStats::default();
+    stats.gfx_render_objects = engine.render_object_count;
+    stats.gfx_lights = engine.light_count;
+    stats.gfx_resolved_models = engine.resolved_models.len() as u64;
+    stats.gfx_async_load_slots = engine.async_loads.len() as u64;
+    for group in &engine.instance_groups {
+        if group.live {
+            stats.gfx_instance_groups += 1;
+            stats.gfx_instanced_objects += group.objects.len() as u64;
+        }
+    }
+    stats.physx_rigid_bodies = engine.physics.rigid_body_count() as u64;
+    stats.physx_materials = engine.physics.material_count() as u64;
+    stats.physx_contacts = engine.physics.contact_count() as u64;
+    stats.audio_sources = engine.audio.source_count() as u64;
+    stats.audio_streams = engine.audio.stream_count() as u64;
+    stats.audio_buses = engine.audio.bus_count() as u64;
+    unsafe { *out = stats };
+    1
+}
+
 ////////////////////////////////////////////
 //////////////////PAIRING///////////////////
 ////////////////////////////////////////////
@@ -560,11 +891,304 @@ pub extern "C" fn meshi_gfx_create_render_object(
         .render
         .register_object(&GfxRenderObjectInfo::Model(model))
         .expect("Unable to register object");
+    engine.render_object_count += 1;
     meshi_gfx_set_transform(engine, h, &info.transform);
 
     h
 }
 
+/// Resolve a mesh name to a stable asset handle.
+///
+/// The database lookup and string hash happen once; repeated calls with the
+/// same name return the same handle. Returns an invalid handle if any pointer
+/// is null or the name is not valid UTF-8.
+#[no_mangle]
+pub extern "C" fn meshi_gfx_resolve_mesh(
+    engine: *mut MeshiEngine,
+    name: *const c_char,
+) -> Handle<MeshAsset> {
+    return_if_null!(Handle::default(), engine, name);
+    let engine = unsafe { &mut *engine };
+    let name = match unsafe { CStr::from_ptr(name) }.to_str() {
+        Ok(name) => name,
+        Err(_) => return Handle::default(),
+    };
+
+    let slot = engine.resolve_model_slot(name);
+
+    let mut h = Handle::<MeshAsset>::default();
+    h.slot = slot;
+    h.generation = 0;
+    h
+}
+
+/// Create a renderable from a mesh handle previously resolved with
+/// [`meshi_gfx_resolve_mesh`]; the spawn path touches no strings.
+#[no_mangle]
+pub extern "C" fn meshi_gfx_create_render_object_from_mesh(
+    render: *mut MeshiEngine,
+    mesh: Handle<MeshAsset>,
+    transform: *const Mat4,
+) -> Handle<RenderObject> {
+    return_if_null!(Handle::default(), render, transform);
+    let engine: &mut MeshiEngine = unsafe { &mut (*render) };
+    if !mesh.valid() {
+        return Handle::default();
+    }
+    let model = match engine.resolved_models.get(mesh.slot as usize) {
+        Some(model) => model.clone(),
+        None => return Handle::default(),
+    };
+    let h = engine
+        .render
+        .register_object(&GfxRenderObjectInfo::Model(model))
+        .expect("Unable to register object");
+    engine.render.set_object_transform(h, unsafe { &*transform });
+    engine.render_object_count += 1;
+    h
+}
+
+/// Queue a renderable whose asset loads under the engine's per-frame budget.
+///
+/// Returns a ticket immediately; the disk read and GPU upload happen inside
+/// later updates, bounded by [`meshi_gfx_set_async_load_budget`], so the
+/// spawn itself costs microseconds regardless of asset residency. Claim the
+/// renderable with [`meshi_gfx_poll_async_render_object`].
+///
+/// # Safety
+/// `render` must be a valid pointer obtained from [`meshi_get_graphics_system`]
+/// and `info` must point to a valid [`RenderObjectInfo`].
+#[no_mangle]
+pub extern "C" fn meshi_gfx_create_render_object_async(
+    render: *mut MeshiEngine,
+    info: *const RenderObjectInfo,
+) -> Handle<AsyncRenderLoad> {
+    return_if_null!(Handle::default(), render, info);
+    let engine: &mut MeshiEngine = unsafe { &mut (*render) };
+    let info: &RenderObjectInfo = unsafe { &(*info) };
+    let mesh = unsafe { CStr::from_ptr(info.mesh) }
+        .to_str()
+        .unwrap_or("model/default")
+        .to_string();
+
+    let slot = engine.alloc_async_slot();
+    let entry = &mut engine.async_loads[slot as usize];
+    entry.state = ASYNC_LOAD_PENDING;
+    entry.generation = entry.generation.wrapping_add(1).max(1);
+    entry.mesh = mesh;
+    entry.transform = info.transform;
+    entry.result = Handle::default();
+    let generation = entry.generation;
+    engine.async_pending += 1;
+
+    let mut h = Handle::<AsyncRenderLoad>::default();
+    h.slot = slot;
+    h.generation = generation;
+    h
+}
+
+/// Poll an async load ticket.
+///
+/// Returns 0 while the load is pending, 1 once it completed (the renderable
+/// handle is written to `out_handle` and the ticket is consumed), and -1 for
+/// an invalid or already-claimed ticket.
+///
+/// # Safety
+/// `render` and `out_handle` must be valid pointers.
+#[no_mangle]
+pub extern "C" fn meshi_gfx_poll_async_render_object(
+    render: *mut MeshiEngine,
+    ticket: Handle<AsyncRenderLoad>,
+    out_handle: *mut Handle<RenderObject>,
+) -> i32 {
+    if render.is_null() || out_handle.is_null() {
+        return -1;
+    }
+    let engine: &mut MeshiEngine = unsafe { &mut (*render) };
+    let state = match engine.async_loads.get(ticket.slot as usize) {
+        Some(entry) if entry.generation == ticket.generation => entry.state,
+        _ => return -1,
+    };
+    match state {
+        ASYNC_LOAD_PENDING => 0,
+        ASYNC_LOAD_READY => {
+            let entry = &mut engine.async_loads[ticket.slot as usize];
+            unsafe { *out_handle = entry.result };
+            entry.state = ASYNC_LOAD_FREE;
+            engine.async_free_slots.push(ticket.slot);
+            1
+        }
+        _ => -1,
+    }
+}
+
+/// Cap how many milliseconds each update spends completing queued async
+/// loads. At least one load still progresses per update.
+///
+/// # Safety
+/// `engine` must be a valid pointer.
+#[no_mangle]
+pub extern "C" fn meshi_gfx_set_async_load_budget(engine: *mut MeshiEngine, milliseconds: f32) {
+    return_if_null!((), engine);
+    unsafe { &mut *engine }.async_load_budget_ms = milliseconds.max(0.0);
+}
+
+/// Create a group of `count` instances of one mesh behind a single handle.
+///
+/// The mesh is resolved once; every instance clones the cached model and gets
+/// its transform from `instances`. One call replaces `count` create calls and
+/// `count` handles on the caller's side.
+///
+/// # Safety
+/// `render` must be a valid pointer obtained from [`meshi_get_graphics_system`],
+/// `info` must point to a valid [`RenderObjectInfo`], and `instances` must
+/// point to at least `count` matrices.
+#[no_mangle]
+pub extern "C" fn meshi_gfx_create_instanced_render_object(
+    render: *mut MeshiEngine,
+    info: *const RenderObjectInfo,
+    instances: *const Mat4,
+    count: usize,
+) -> Handle<InstanceGroup> {
+    return_if_null!(Handle::default(), render, info, instances);
+    let engine: &mut MeshiEngine = unsafe { &mut (*render) };
+    let info: &RenderObjectInfo = unsafe { &(*info) };
+    let mesh = unsafe { CStr::from_ptr(info.mesh) }
+        .to_str()
+        .unwrap_or("model/default");
+    let model_slot = engine.resolve_model_slot(mesh);
+    let transforms = unsafe { std::slice::from_raw_parts(instances, count) };
+
+    let mut objects = Vec::with_capacity(count);
+    for transform in transforms {
+        let model = engine.resolved_models[model_slot as usize].clone();
+        let h = engine
+            .render
+            .register_object(&GfxRenderObjectInfo::Model(model))
+            .expect("Unable to register object");
+        engine.render.set_object_transform(h, transform);
+        objects.push(h);
+    }
+
+    let slot = engine.alloc_instance_group_slot();
+    let entry = &mut engine.instance_groups[slot as usize];
+    entry.live = true;
+    entry.generation = entry.generation.wrapping_add(1).max(1);
+    entry.objects = objects;
+    let generation = entry.generation;
+
+    let mut h = Handle::<InstanceGroup>::default();
+    h.slot = slot;
+    h.generation = generation;
+    h
+}
+
+/// Refresh the transforms of instances `[first, first + count)` in a group.
+///
+/// The range is clamped to the group's size. Returns the number of instances
+/// updated, or 0 for a stale or invalid group handle.
+///
+/// # Safety
+/// `render` must be a valid pointer obtained from [`meshi_get_graphics_system`]
+/// and `transforms` must point to at least `count` matrices.
+#[no_mangle]
+pub extern "C" fn meshi_gfx_update_instance_transforms(
+    render: *mut MeshiEngine,
+    group: Handle<InstanceGroup>,
+    transforms: *const Mat4,
+    first: usize,
+    count: usize,
+) -> usize {
+    if render.is_null() || transforms.is_null() {
+        return 0;
+    }
+    let engine: &mut MeshiEngine = unsafe { &mut (*render) };
+    let entry = match engine.instance_groups.get(group.slot as usize) {
+        Some(entry) if entry.live && entry.generation == group.generation => entry,
+        _ => return 0,
+    };
+    if first >= entry.objects.len() {
+        return 0;
+    }
+    let count = count.min(entry.objects.len() - first);
+    let transforms = unsafe { std::slice::from_raw_parts(transforms, count) };
+    for (h, transform) in entry.objects[first..first + count].iter().zip(transforms) {
+        engine.render.set_object_transform(*h, transform);
+    }
+    count
+}
+
+/// Release an instance group and every renderable it owns.
+///
+/// # Safety
+/// `render` and `h` must be valid pointers.
+#[no_mangle]
+pub extern "C" fn meshi_gfx_release_instanced_render_object(
+    render: *mut MeshiEngine,
+    h: *const Handle<InstanceGroup>,
+) {
+    if render.is_null() || h.is_null() {
+        return;
+    }
+    let engine: &mut MeshiEngine = unsafe { &mut (*render) };
+    let group = unsafe { *h };
+    let objects = match engine.instance_groups.get_mut(group.slot as usize) {
+        Some(entry) if entry.live && entry.generation == group.generation => {
+            entry.live = false;
+            std::mem::take(&mut entry.objects)
+        }
+        _ => return,
+    };
+    for object in objects {
+        engine.render.release_object(object);
+    }
+    engine.instance_group_free_slots.push(group.slot);
+}
+
+/// Register a batch of renderable objects in a single call.
+///
+/// Handles are written element-for-element into `out_handles`. Returns the
+/// number of objects created.
+///
+/// # Safety
+/// `render` must be a valid pointer obtained from [`meshi_get_graphics_system`].
+/// `infos` and `out_handles` must each point to at least `count` elements.
+#[no_mangle]
+pub extern "C" fn meshi_gfx_create_render_objects(
+    render: *mut MeshiEngine,
+    infos: *const RenderObjectInfo,
+    out_handles: *mut Handle<RenderObject>,
+    count: usize,
+) -> usize {
+    if render.is_null() || infos.is_null() || out_handles.is_null() {
+        return 0;
+    }
+    let engine: &mut MeshiEngine = unsafe { &mut (*render) };
+    let infos = unsafe { std::slice::from_raw_parts(infos, count) };
+    let out = unsafe { std::slice::from_raw_parts_mut(out_handles, count) };
+    let mut created = 0;
+    for (info, out_h) in infos.iter().zip(out) {
+        let mesh = unsafe { CStr::from_ptr(info.mesh) }
+            .to_str()
+            .unwrap_or("model/default");
+
+        let model = engine
+            .database
+            .fetch_gpu_model(mesh)
+            .expect("Failed to  load model!");
+
+        let h = engine
+            .render
+            .register_object(&GfxRenderObjectInfo::Model(model))
+            .expect("Unable to register object");
+        engine.render.set_object_transform(h, &info.transform);
+        *out_h = h;
+        created += 1;
+    }
+    engine.render_object_count += created as u64;
+    created
+}
+
 #[no_mangle]
 pub extern "C" fn meshi_gfx_release_render_object(
     render: *mut MeshiEngine,
@@ -577,6 +1201,7 @@ pub extern "C" fn meshi_gfx_release_render_object(
     let engine: &mut MeshiEngine = unsafe { &mut (*render) };
     engine.remove_pairs_for_render(unsafe { *h });
     engine.render.release_object(unsafe { *h });
+    engine.render_object_count = engine.render_object_count.saturating_sub(1);
 }
 
 /// Update the transformation matrix for a renderable object.
@@ -608,6 +1233,37 @@ pub extern "C" fn meshi_gfx_set_transform(
         .set_object_transform(h, unsafe { &*transform });
 }
 
+/// Update the transformation matrices for a batch of renderable objects in a
+/// single call.
+///
+/// Invalid handles within the batch are skipped.
+///
+/// # Safety
+/// `render` must be obtained from [`meshi_get_graphics_system`]. `handles` and
+/// `transforms` must each point to at least `count` elements. If any pointer is
+/// null this function returns without modifying any renderable.
+#[no_mangle]
+pub extern "C" fn meshi_gfx_set_transforms(
+    render: *mut MeshiEngine,
+    handles: *const Handle<RenderObject>,
+    transforms: *const Mat4,
+    count: usize,
+) {
+    if render.is_null() || handles.is_null() || transforms.is_null() {
+        return;
+    }
+
+    let engine: &mut MeshiEngine = unsafe { &mut (*render) };
+    let handles = unsafe { std::slice::from_raw_parts(handles, count) };
+    let transforms = unsafe { std::slice::from_raw_parts(transforms, count) };
+    for (h, transform) in handles.iter().zip(transforms) {
+        if !h.valid() {
+            continue;
+        }
+        engine.render.set_object_transform(*h, transform);
+    }
+}
+
 /// Create a directional light for the scene.
 ///
 /// # Safety
@@ -622,6 +1278,7 @@ pub extern "C" fn meshi_gfx_create_light(
     }
 
     let engine: &mut MeshiEngine = unsafe { &mut (*render) };
+    engine.light_count += 1;
     engine.render.register_light(unsafe { &*info })
 }
 
@@ -633,6 +1290,7 @@ pub extern "C" fn meshi_gfx_release_light(render: *mut MeshiEngine, h: *const Ha
 
     let engine: &mut MeshiEngine = unsafe { &mut (*render) };
     engine.render.release_light(unsafe { *h });
+    engine.light_count = engine.light_count.saturating_sub(1);
 }
 
 /// Update the transform for a directional light.
@@ -1146,6 +1804,126 @@ pub extern "C" fn meshi_physx_get_rigid_body_status(
     }
 }
 
+/// Retrieve position/rotation for a batch of rigid bodies in a single call.
+///
+/// Statuses are written element-for-element into `out_statuses`; entries whose
+/// handle does not reference a valid body are left untouched. Returns the
+/// number of statuses written.
+///
+/// # Safety
+/// `engine` must be valid. `handles` and `out_statuses` must each point to at
+/// least `count` elements. If any pointer is null this function returns 0.
+#[no_mangle]
+pub extern "C" fn meshi_physx_get_rigid_body_statuses(
+    engine: *mut MeshiEngine,
+    handles: *const Handle<meshi_physics::RigidBody>,
+    out_statuses: *mut meshi_physics::ActorStatus,
+    count: usize,
+) -> usize {
+    if engine.is_null() || handles.is_null() || out_statuses.is_null() {
+        return 0;
+    }
+    let physics = unsafe { &(*engine).physics };
+    let handles = unsafe { std::slice::from_raw_parts(handles, count) };
+    let out = unsafe { std::slice::from_raw_parts_mut(out_statuses, count) };
+    let mut written = 0;
+    for (h, slot) in handles.iter().zip(out) {
+        if let Some(status) = physics.get_rigid_body_status(*h) {
+            *slot = status;
+            written += 1;
+        }
+    }
+    written
+}
+
+/// Run the physics simulation on a fixed timestep of `step_secs` seconds.
+///
+/// Updates then accumulate the frame's dt and step in whole ticks, so
+/// simulation cost no longer scales with the display refresh rate. Pass
+/// zero to restore variable stepping.
+///
+/// # Safety
+/// `engine` must be a valid pointer.
+#[no_mangle]
+pub extern "C" fn meshi_physx_set_fixed_timestep(engine: *mut MeshiEngine, step_secs: f32) {
+    return_if_null!((), engine);
+    unsafe { &mut (*engine).physics }.set_fixed_timestep(step_secs);
+}
+
+/// Blend factor between the last two physics ticks (0 = previous tick,
+/// 1 = current). Pass it to the interpolated status queries for smooth
+/// readback between fixed steps. Always 1.0 under variable stepping.
+///
+/// # Safety
+/// `engine` must be a valid pointer.
+#[no_mangle]
+pub extern "C" fn meshi_physx_get_interpolation_alpha(engine: *mut MeshiEngine) -> f32 {
+    if engine.is_null() {
+        return 1.0;
+    }
+    unsafe { &(*engine).physics }.interpolation_alpha()
+}
+
+/// Retrieve a rigid body's status blended between the last two simulation
+/// steps.
+///
+/// # Safety
+/// `engine`, `h`, and `out_status` must all be valid pointers. The function
+/// returns immediately and leaves `out_status` untouched if any pointer is
+/// null.
+#[no_mangle]
+pub extern "C" fn meshi_physx_get_rigid_body_status_interpolated(
+    engine: *mut MeshiEngine,
+    h: *const Handle<meshi_physics::RigidBody>,
+    alpha: f32,
+    out_status: *mut meshi_physics::ActorStatus,
+) -> i32 {
+    if engine.is_null() || h.is_null() || out_status.is_null() {
+        return 0;
+    }
+    if let Some(status) =
+        unsafe { &(*engine).physics }.get_rigid_body_status_interpolated(unsafe { *h }, alpha)
+    {
+        unsafe { *out_status = status };
+        1
+    } else {
+        0
+    }
+}
+
+/// Retrieve interpolated statuses for a batch of rigid bodies in one call.
+///
+/// Statuses are written element-for-element into `out_statuses`; entries whose
+/// handle does not reference a valid body are left untouched. Returns the
+/// number of statuses written.
+///
+/// # Safety
+/// `engine` must be valid. `handles` and `out_statuses` must each point to at
+/// least `count` elements. If any pointer is null this function returns 0.
+#[no_mangle]
+pub extern "C" fn meshi_physx_get_rigid_body_statuses_interpolated(
+    engine: *mut MeshiEngine,
+    handles: *const Handle<meshi_physics::RigidBody>,
+    alpha: f32,
+    out_statuses: *mut meshi_physics::ActorStatus,
+    count: usize,
+) -> usize {
+    if engine.is_null() || handles.is_null() || out_statuses.is_null() {
+        return 0;
+    }
+    let physics = unsafe { &(*engine).physics };
+    let handles = unsafe { std::slice::from_raw_parts(handles, count) };
+    let out = unsafe { std::slice::from_raw_parts_mut(out_statuses, count) };
+    let mut written = 0;
+    for (h, slot) in handles.iter().zip(out) {
+        if let Some(status) = physics.get_rigid_body_status_interpolated(*h, alpha) {
+            *slot = status;
+            written += 1;
+        }
+    }
+    written
+}
+
 /// Retrieve the current velocity of a rigid body.
 ///
 /// If any pointer is invalid or the handle does not reference a valid body,
@@ -1212,6 +1990,35 @@ pub extern "C" fn meshi_physx_get_contacts(
     count
 }
 
+/// Map the plugin-owned contact buffer for zero-copy reading.
+///
+/// Writes a pointer to the current contact snapshot and its length, and
+/// returns a sequence number that advances whenever the snapshot is
+/// regenerated. Callers that remember the last consumed sequence can skip
+/// walking the buffer when nothing changed.
+///
+/// # Safety
+/// All pointers must be valid. The mapped buffer is owned by the plugin and
+/// is invalidated by the next engine update; it must not be held across
+/// frames or freed by the caller.
+#[no_mangle]
+pub extern "C" fn meshi_physx_map_contacts(
+    engine: *mut MeshiEngine,
+    out_contacts: *mut *const ContactInfo,
+    out_count: *mut usize,
+) -> u64 {
+    if engine.is_null() || out_contacts.is_null() || out_count.is_null() {
+        return 0;
+    }
+    let engine = unsafe { &*engine };
+    let contacts = engine.physics.get_contacts();
+    unsafe {
+        *out_contacts = contacts.as_ptr();
+        *out_count = contacts.len();
+    }
+    engine.contact_sequence
+}
+
 #[no_mangle]
 pub extern "C" fn meshi_physx_collision_shape_sphere(radius: f32) -> CollisionShape {
     CollisionShape {